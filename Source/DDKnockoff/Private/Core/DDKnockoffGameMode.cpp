@@ -1,9 +1,14 @@
 #include "Core/DDKnockoffGameMode.h"
 
+#include "EngineUtils.h"
+#include "Crystal/CrystalStructure.h"
+#include "Currency/CurrencyCrystal.h"
+
 #include "Entities//EntityManager.h"
 #include "LevelLogic/WaveManager.h"
 #include "UObject/ConstructorHelpers.h"
 #include "TimerManager.h"
+#include "Misc/CommandLine.h"
 #include "Debug/DebugInformationManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Currency/CurrencyManager.h"
@@ -12,6 +17,12 @@
 #include "Core/DDKnockoffGameSettings.h"
 #include "Core/ManagerHandlerSubsystem.h"
 #include "Structures/StructurePlacementManager.h"
+#include "Enemies/AIDirectorManager.h"
+#include "Enemies/AISignificanceManager.h"
+#include "Enemies/CrystalPathFieldManager.h"
+#include "Enemies/EngagementManager.h"
+#include "Enemies/FlowFieldMovementManager.h"
+#include "Enemies/PathRequestManager.h"
 
 ADDKnockoffGameMode::ADDKnockoffGameMode()
     : WaveManager(nullptr), EntityManager(nullptr), ReadyUpProgress(0.0f), bIsReadyingUp(false) {
@@ -37,7 +48,8 @@ void ADDKnockoffGameMode::Tick(float DeltaSeconds) {
 }
 
 void ADDKnockoffGameMode::OnCharacterPressedReadyUpInput() {
-    if (!IsInAPreparationPhase()) { return; }
+    // Initial preparation lasts at least until every manager asset has streamed in
+    if (!IsInAPreparationPhase() || !AreManagersReady()) { return; }
     if (!bIsReadyingUp) { StartReadyUp(); }
 }
 
@@ -75,10 +87,21 @@ FString ADDKnockoffGameMode::GetDebugInformation() const {
                                             ? FString::Printf(TEXT("%.2f"), RemainingTime)
                                             : TEXT("N/A");
 
-    return FString::Printf(TEXT("Phase: %s\nReady-Up Status: %s\nPhase time Remaining: %s"),
-                           *PhaseString,
-                           *ReadyUpStatus,
-                           *TimeRemainingString);
+    // Manager asset streaming, only known once it has finished
+    FString AssetLoadString = TEXT("Loading");
+    if (AreManagersReady()) {
+        const FManagerAssetLoadStats& LoadStats = ManagerHandlerSubsystem->GetAssetLoadStats();
+        AssetLoadString = FString::Printf(TEXT("%d assets in %.2fs"),
+                                          LoadStats.NumAssets,
+                                          LoadStats.LoadSeconds);
+    }
+
+    return FString::Printf(
+        TEXT("Phase: %s\nReady-Up Status: %s\nPhase time Remaining: %s\nManager Assets: %s"),
+        *PhaseString,
+        *ReadyUpStatus,
+        *TimeRemainingString,
+        *AssetLoadString);
 }
 
 
@@ -90,76 +113,111 @@ void ADDKnockoffGameMode::StartPlay() {
     ManagerHandlerSubsystem = GetWorld()->GetSubsystem<UManagerHandlerSubsystem>();
     ensureAlways(ManagerHandlerSubsystem);
 
-    ManagerHandlerSubsystem->SetManagers({
-        UDebugInformationManager::StaticClass(),
-        UEntityManager::StaticClass(),
-        UWaveManager::StaticClass(),
-        UCurrencyManager::StaticClass(),
-        UStructurePlacementManager::StaticClass(),
-    });
+    // Stream every manager's settings, and the currency settings, in one batch
+    ManagerHandlerSubsystem->SetManagers(
+        {
+            UDebugInformationManager::StaticClass(),
+            UEntityManager::StaticClass(),
+            UWaveManager::StaticClass(),
+            UCurrencyManager::StaticClass(),
+            UStructurePlacementManager::StaticClass(),
+            UCrystalPathFieldManager::StaticClass(),
+            UAIDirectorManager::StaticClass(),
+            UFlowFieldMovementManager::StaticClass(),
+            UPathRequestManager::StaticClass(),
+            UAISignificanceManager::StaticClass(),
+            UEngagementManager::StaticClass(),
+        },
+        EManagerAssetLoading::Streamed,
+        {CurrencyManagerSettings.ToSoftObjectPath()});
 
     // TODO - maybe make these references, these subsystems should be available for the game modes whole lifetime.
     EntityManager = ManagerHandlerSubsystem->GetManager<UEntityManager>();
     WaveManager = ManagerHandlerSubsystem->GetManager<UWaveManager>();
+    CurrencyManager = ManagerHandlerSubsystem->GetManager<UCurrencyManager>();
+
+    BindToEntityEvents();
+    RecordStartingCrystals();
+    
+    StartInitialPreparationPhase();
 
+    ManagerHandlerSubsystem->CallWhenManagersReady(
+        FSimpleDelegate::CreateUObject(this, &ADDKnockoffGameMode::OnManagersReady));
+
+    Super::StartPlay();
+}
+
+void ADDKnockoffGameMode::OnManagersReady() {
     // TODO - Currency manager settings loading should be done within the class itself, not here, like the other managers.
-    CurrencyManager = ManagerHandlerSubsystem->GetManager<UCurrencyManager>();
     if (CurrencyManagerSettings.IsValid() || CurrencyManagerSettings.IsPending()) {
+        // Streamed in with the manager assets, so this only resolves the pointer
         UCurrencyManagerSettings* LoadedSettings = CurrencyManagerSettings.LoadSynchronous();
         CurrencyManager->SetSettings(LoadedSettings);
     }
-    
-    BindToEntityEvents();
-    
-    StartInitialPreparationPhase();
 
     // Register with debug information subsystem
     if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
         UDebugInformationManager>(GetWorld())) {
         DebugSubsystem->RegisterDebugInformationProvider(this);
     }
+}
 
-    Super::StartPlay();
+bool ADDKnockoffGameMode::AreManagersReady() const {
+    return ManagerHandlerSubsystem && ManagerHandlerSubsystem->AreManagersReady();
 }
 
 void ADDKnockoffGameMode::BindToEntityEvents() {
-    EntityManager->OnEntityRemoved.RemoveDynamic(this, &ADDKnockoffGameMode::OnEntityRemoved);
-    EntityManager->OnEntityRemoved.AddDynamic(this, &ADDKnockoffGameMode::OnEntityRemoved);
+    EntityManager->UnsubscribeFromChanges(CrystalsRemovedHandle);
+    EntityManager->UnsubscribeFromChanges(EnemiesRemovedHandle);
+
+    // Only wake for the removals that can end a wave or the game
+    FEntityChangeFilter CrystalFilter;
+    CrystalFilter.ChangeTypes = EEntityChangeType::Removed;
+    CrystalFilter.Faction = EFaction::Player;
+    CrystalFilter.Type = EEntityType::Structure_Crystal;
+    CrystalsRemovedHandle = EntityManager->SubscribeToChanges(
+        CrystalFilter,
+        FOnEntityChangesDelegate::CreateUObject(this, &ADDKnockoffGameMode::OnCrystalsRemoved));
+
+    FEntityChangeFilter EnemyFilter;
+    EnemyFilter.ChangeTypes = EEntityChangeType::Removed;
+    EnemyFilter.Faction = EFaction::Enemy;
+    EnemyFilter.Type = EEntityType::Character;
+    EnemiesRemovedHandle = EntityManager->SubscribeToChanges(
+        EnemyFilter,
+        FOnEntityChangesDelegate::CreateUObject(this, &ADDKnockoffGameMode::OnEnemiesRemoved));
 }
 
 bool ADDKnockoffGameMode::AreAllEnemiesDead() const {
     if (!EntityManager) { return true; }
 
-    // Get all entities that are characters and enemies
-    const TArray<TScriptInterface<IEntity>> EnemyEntities = EntityManager->
-        GetEntitiesByFactionAndType(EFaction::Enemy, EEntityType::Character);
-    return EnemyEntities.Num() == 0;
+    // Count all entities that are characters and enemies
+    return EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character) == 0;
 }
 
 bool ADDKnockoffGameMode::AreAllCrystalsDead() const {
     if (!EntityManager) { return true; }
 
-    // Get all entities that are crystals
-    const TArray<TScriptInterface<IEntity>> CrystalEntities = EntityManager->
-        GetEntitiesByFactionAndType(EFaction::Player, EEntityType::Structure_Crystal);
-    return CrystalEntities.Num() == 0;
+    // Count all entities that are crystals
+    return EntityManager->CountByFactionAndType(EFaction::Player, EEntityType::Structure_Crystal)
+           == 0;
 }
 
-void ADDKnockoffGameMode::OnEntityRemoved(const TScriptInterface<IEntity>& Entity) {
-    // If we're in combat phase and an enemy was removed, check if all enemies are dead
-    if (CurrentGamePhase == EGamePhase::Combat && Entity) {
-        if (Entity->GetFaction() == EFaction::Enemy) {
-            if (AreAllEnemiesDead()) {
-                // If this was the last wave, go to reward phase
-                if (WaveManager && WaveManager->GetCurrentState() == EWaveState::SpawningComplete) {
-                    StartRewardPhase();
-                } else { StartInterCombatPreparationPhase(); }
-            }
-        }
-        // Check for crystal deaths
-        else if (Entity->GetEntityType() == EEntityType::Structure_Crystal) {
-            if (AreAllCrystalsDead()) { StartDefeatPhase(); }
-        }
+void ADDKnockoffGameMode::OnCrystalsRemoved(TConstArrayView<FEntityChangeRecord> Changes) {
+    if (CurrentGamePhase != EGamePhase::Combat) { return; }
+
+    if (AreAllCrystalsDead()) { StartDefeatPhase(); }
+}
+
+void ADDKnockoffGameMode::OnEnemiesRemoved(TConstArrayView<FEntityChangeRecord> Changes) {
+    // Also guards against a defeat triggered by the crystal handler in the same dispatch
+    if (CurrentGamePhase != EGamePhase::Combat) { return; }
+
+    if (AreAllEnemiesDead()) {
+        // If this was the last wave, go to reward phase
+        if (WaveManager && WaveManager->GetCurrentState() == EWaveState::SpawningComplete) {
+            StartRewardPhase();
+        } else { StartInterCombatPreparationPhase(); }
     }
 }
 
@@ -178,15 +236,16 @@ void ADDKnockoffGameMode::SetGamePhase(EGamePhase NewPhase) {
 }
 
 void ADDKnockoffGameMode::StartCombatPhase() {
+    if (!AreManagersReady()) { return; }
+
     SetGamePhase(EGamePhase::Combat);
 
     // Clear any existing timers
     GetWorldTimerManager().ClearTimer(PhaseTransitionTimerHandle);
 
-    // If wave manager is waiting to start, begin the wave
-    if (WaveManager && WaveManager->GetCurrentState() == EWaveState::WaitingToStart) {
-        WaveManager->StartNextWave();
-    }
+    // Begin the wave - the wave manager ignores this unless it is waiting to start, and finishes
+    // collecting spawners first if that is still running
+    if (WaveManager) { WaveManager->StartNextWave(); }
 }
 
 void ADDKnockoffGameMode::StartInterCombatPreparationPhase() {
@@ -198,8 +257,8 @@ void ADDKnockoffGameMode::StartInterCombatPreparationPhase() {
 
     // Reset all chests in the level via the entity manager
     // TODO - I don't like this way of doing things, it's gross and wasteful. Need a better alternative than this.
-    auto Entities = EntityManager->GetEntitiesByType(EEntityType::Interactable);
-    for (const TScriptInterface<IEntity>& Entity : Entities) {
+    for (const TScriptInterface<IEntity>& Entity :
+         EntityManager->ViewEntitiesByType(EEntityType::Interactable)) {
         if (Entity) {
             if (AResourceChest* Chest = Cast<AResourceChest>(Entity->GetActor())) {
                 Chest->ResetChest();
@@ -214,11 +273,11 @@ void ADDKnockoffGameMode::StartRewardPhase() {
 
     SetGamePhase(EGamePhase::Reward);
 
-    // Set timer to reload the map after reward duration
+    // Set timer to restart after reward duration
     GetWorldTimerManager().SetTimer(
         PhaseTransitionTimerHandle,
         this,
-        &ADDKnockoffGameMode::ReloadCurrentMap,
+        &ADDKnockoffGameMode::RestartLevel,
         RewardPhaseDuration,
         false
         );
@@ -236,14 +295,86 @@ void ADDKnockoffGameMode::ReloadCurrentMap() const {
     UGameplayStatics::OpenLevel(this, FName(*CurrentLevelName));
 }
 
+void ADDKnockoffGameMode::RestartLevel() {
+    static const bool bForceReload = FParse::Param(FCommandLine::Get(), TEXT("DDReloadOnRestart"));
+    if (bSoftResetOnRestart && !bForceReload && AreManagersReady()) {
+        SoftResetLevel();
+    } else { ReloadCurrentMap(); }
+}
+
+void ADDKnockoffGameMode::SoftResetLevel() {
+    if (!AreManagersReady()) { return; }
+
+    const double ResetStartTime = FPlatformTime::Seconds();
+    GetWorldTimerManager().ClearTimer(PhaseTransitionTimerHandle);
+    CancelReadyUp();
+
+    // Leave combat first so the removals below can't end a wave or the game
+    StartInitialPreparationPhase();
+
+    // Destroy what play spawned and reset the rest. Copied since destruction edits the registry
+    const TArray<TScriptInterface<IEntity>> Entities = EntityManager->GetAllEntities();
+    for (const TScriptInterface<IEntity>& Entity : Entities) {
+        if (!Entity) { continue; }
+
+        if (IsSpawnedDuringPlay(*Entity)) {
+            if (AActor* Actor = Entity->GetActor()) { Actor->Destroy(); }
+        } else { Entity->ResetEntity(); }
+    }
+    for (TActorIterator<ACurrencyCrystal> It(GetWorld()); It; ++It) { It->Destroy(); }
+
+    RestoreStartingCrystals();
+
+    // Apply the queued registrations and removals before the entity manager is refreshed
+    EntityManager->CommitPendingOperations();
+    ManagerHandlerSubsystem->RefreshManagers();
+    WaveManager->CloseDoors();
+
+    UE_LOG(LogTemp,
+           Log,
+           TEXT("Soft level reset took %.2fms"),
+           (FPlatformTime::Seconds() - ResetStartTime) * 1000.0);
+}
+
+void ADDKnockoffGameMode::RecordStartingCrystals() {
+    StartingCrystals.Reset();
+    for (TActorIterator<ACrystalStructure> It(GetWorld()); It; ++It) {
+        FStartingCrystal& StartingCrystal = StartingCrystals.AddDefaulted_GetRef();
+        StartingCrystal.CrystalClass = It->GetClass();
+        StartingCrystal.Transform = It->GetActorTransform();
+        StartingCrystal.Instance = *It;
+    }
+}
+
+void ADDKnockoffGameMode::RestoreStartingCrystals() {
+    for (FStartingCrystal& StartingCrystal : StartingCrystals) {
+        if (StartingCrystal.Instance.IsValid()) { continue; }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride =
+            ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        StartingCrystal.Instance = GetWorld()->SpawnActor<ACrystalStructure>(
+            StartingCrystal.CrystalClass,
+            StartingCrystal.Transform,
+            SpawnParams);
+    }
+}
+
+bool ADDKnockoffGameMode::IsSpawnedDuringPlay(const IEntity& Entity) {
+    const EEntityType Type = Entity.GetEntityType();
+    return Entity.GetFaction() == EFaction::Enemy
+           || Type == EEntityType::Structure_Defense
+           || Type == EEntityType::Projectile;
+}
+
 void ADDKnockoffGameMode::StartDefeatPhase() {
     SetGamePhase(EGamePhase::Defeat);
 
-    // Set timer to reload the map after defeat duration
+    // Set timer to restart after defeat duration
     GetWorldTimerManager().SetTimer(
         PhaseTransitionTimerHandle,
         this,
-        &ADDKnockoffGameMode::ReloadCurrentMap,
+        &ADDKnockoffGameMode::RestartLevel,
         DefeatPhaseDuration,
         false
         );
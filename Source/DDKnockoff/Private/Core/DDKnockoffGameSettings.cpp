@@ -26,4 +26,6 @@ void UDDKnockoffGameSettings::ValidateConfiguration() const {
                      TEXT("HealthBarWidgetClass is not set in DDKnockoffGameSettings"));
     ensureAlwaysMsgf(!DefenseStructuresPath.IsEmpty(),
                      TEXT("DefenseStructuresPath is not set in DDKnockoffGameSettings"));
+    ensureAlwaysMsgf(SimulationTimeStep > 0.0f,
+                     TEXT("SimulationTimeStep must be positive in DDKnockoffGameSettings"));
 }
@@ -0,0 +1,49 @@
+#include "Core/DDKnockoffStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(DDKnockoffChannel);
+
+// Manager handler
+DEFINE_STAT(STAT_ManagerHandler_TickPhase);
+DEFINE_STAT(STAT_ManagerHandler_RunJobs);
+DEFINE_STAT(STAT_ManagerHandler_PendingJobs);
+
+// Entity manager
+DEFINE_STAT(STAT_EntityManager_RegisterEntity);
+DEFINE_STAT(STAT_EntityManager_UnregisterEntity);
+DEFINE_STAT(STAT_EntityManager_CommitPendingOperations);
+DEFINE_STAT(STAT_EntityManager_QueryRadius);
+DEFINE_STAT(STAT_EntityManager_FindNearest);
+DEFINE_STAT(STAT_EntityManager_PublishSnapshot);
+DEFINE_STAT(STAT_EntityManager_DispatchChangeJournal);
+DEFINE_STAT(STAT_EntityManager_NumEntities);
+
+// Wave manager
+DEFINE_STAT(STAT_WaveManager_SpawnWaveEnemies);
+DEFINE_STAT(STAT_WaveManager_CollectSpawners);
+
+// Currency manager
+DEFINE_STAT(STAT_CurrencyManager_CalculateCurrencySpawnInfo);
+
+// Debug information manager
+DEFINE_STAT(STAT_DebugInformationManager_UpdateWidget);
+
+// AI director
+DEFINE_STAT(STAT_AIDirector_Gather);
+DEFINE_STAT(STAT_AIDirector_Decide);
+DEFINE_STAT(STAT_AIDirector_Apply);
+
+// Crystal path field
+DEFINE_STAT(STAT_CrystalPathField_Rebuild);
+DEFINE_STAT(STAT_CrystalPathField_Solve);
+DEFINE_STAT(STAT_CrystalPathField_Sample);
+
+// Flow field movement
+DEFINE_STAT(STAT_FlowFieldMovement_Gather);
+DEFINE_STAT(STAT_FlowFieldMovement_Steer);
+DEFINE_STAT(STAT_FlowFieldMovement_Apply);
+
+// Path requests
+DEFINE_STAT(STAT_PathRequests_Dispatch);
+
+// AI significance
+DEFINE_STAT(STAT_AISignificance_Evaluate);
@@ -1,6 +1,24 @@
 ﻿#include "Core/ManagerBase.h"
+#include "Core/DDKnockoffStats.h"
 
 
 void UManagerBase::Deinitialize() {}
 void UManagerBase::Initialize() {}
 void UManagerBase::Tick(float DeltaTime) {}
+
+void UManagerBase::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {}
+
+void UManagerBase::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const {}
+
+void UManagerBase::PostInitProperties() {
+    Super::PostInitProperties();
+    if (HasAnyFlags(RF_ClassDefaultObject)) { return; }
+
+    // Created here on the game thread, worker ticks only ever read them
+    TraceName = GetClass()->GetName();
+#if STATS
+    TickStatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_DDKnockoff>(TraceName);
+    MemoryStatId = FDynamicStats::CreateMemoryStatId<FStatGroup_STATGROUP_DDKnockoff>(
+        FName(*(TraceName + TEXT(" Memory"))));
+#endif
+}
@@ -1,16 +1,72 @@
 ﻿#include "Core/ManagerHandlerSubsystem.h"
 
 #include "Core/ManagerBase.h"
+#include "Core/DDKnockoffStats.h"
+#include "Core/DDKnockoffGameSettings.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Tasks/Task.h"
 
+const UWorld* UManagerHandlerSubsystem::CachedWorld = nullptr;
+UManagerHandlerSubsystem* UManagerHandlerSubsystem::CachedSubsystem = nullptr;
 
-void UManagerHandlerSubsystem::SetManagers(const TArray<UClass*>& ManagerClasses) {
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs SimulateCommand(
+    TEXT("DD.Simulate"),
+    TEXT("Fast-forward the world at a fixed step. Usage: DD.Simulate <Seconds> [StepSeconds]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+        [](const TArray<FString>& Args, UWorld* World) {
+            UManagerHandlerSubsystem* Subsystem = UManagerHandlerSubsystem::Get(World);
+            if (!Subsystem || Args.IsEmpty()) { return; }
+
+            const float StepSeconds = Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 0.0f;
+            Subsystem->Simulate(FCString::Atof(*Args[0]), StepSeconds);
+        }));
+#endif
+
+int32 FManagerSlotRegistry::GetSlot(const UClass* ManagerClass) {
+    static FCriticalSection Lock;
+    static TMap<const UClass*, int32> SlotsByClass;
+
+    FScopeLock ScopeLock(&Lock);
+    if (const int32* Found = SlotsByClass.Find(ManagerClass)) { return *Found; }
+    return SlotsByClass.Add(ManagerClass, SlotsByClass.Num());
+}
+
+void FManagerPhaseTickFunction::ExecuteTick(const float DeltaTime,
+                                            ELevelTick TickType,
+                                            ENamedThreads::Type CurrentThread,
+                                            const FGraphEventRef& MyCompletionGraphEvent) {
+    if (Handler) { Handler->TickPhase(Phase, DeltaTime); }
+}
+
+FString FManagerPhaseTickFunction::DiagnosticMessage() {
+    const UEnum* PhaseEnum = StaticEnum<EManagerTickPhase>();
+    return FString::Printf(TEXT("ManagerHandlerSubsystem[%s]"),
+                           PhaseEnum
+                               ? *PhaseEnum->GetNameStringByValue(static_cast<int64>(Phase))
+                               : TEXT("Unknown"));
+}
+
+
+void UManagerHandlerSubsystem::SetManagers(const TArray<UClass*>& ManagerClasses,
+                                           const EManagerAssetLoading AssetLoading,
+                                           const TArray<FSoftObjectPath>& AdditionalAssets) {
     ClearManagers();
 
+    // Create every manager up front so dependencies can be resolved regardless of list order
+    TArray<UManagerBase*> CreatedManagers;
     for (int i = 0; i < ManagerClasses.Num(); ++i) {
         UClass* ManagerClass = ManagerClasses[i];
         if (UManagerBase* NewManager = NewObject<UManagerBase>(this, ManagerClass)) {
-            Managers.Add(ManagerClass, NewManager);
-            NewManager->Initialize();
+            const int32 Slot = FManagerSlotRegistry::GetSlot(ManagerClass);
+            if (Slot >= ManagersBySlot.Num()) { ManagersBySlot.SetNumZeroed(Slot + 1); }
+            ManagersBySlot[Slot] = NewManager;
+            CreatedManagers.Add(NewManager);
         } else {
             UE_LOG(LogTemp,
                    Warning,
@@ -18,29 +74,524 @@ void UManagerHandlerSubsystem::SetManagers(const TArray<UClass*>& ManagerClasses
                    *ManagerClass->GetName());
         }
     }
+
+    if (SortByDependencies(CreatedManagers, InitializationLevels)) {
+        for (const TArray<UManagerBase*>& Level : InitializationLevels) {
+            OrderedManagers.Append(Level);
+        }
+    } else {
+        ensureAlwaysMsgf(false,
+                         TEXT("Manager dependency cycle detected, falling back to list order"));
+
+        // One manager per level keeps the fallback strictly sequential
+        OrderedManagers = CreatedManagers;
+        InitializationLevels.Reset();
+        for (UManagerBase* Manager : CreatedManagers) { InitializationLevels.Add({Manager}); }
+    }
+
+    for (UManagerBase* Manager : OrderedManagers) {
+        PhaseManagers[static_cast<int32>(Manager->GetTickPhase())].Add(Manager);
+    }
+    RegisterPhaseTickFunction(PrePhysicsTickFunction,
+                              EManagerTickPhase::PrePhysics,
+                              TG_PrePhysics);
+    RegisterPhaseTickFunction(PostPhysicsTickFunction,
+                              EManagerTickPhase::PostPhysics,
+                              TG_PostPhysics);
+
+    CurrentAssetLoading = AssetLoading;
+    AdditionalPreloadAssets = AdditionalAssets;
+    AssetLoadStats = FManagerAssetLoadStats();
+    AssetLoadStats.bStreamed = AssetLoading == EManagerAssetLoading::Streamed;
+    PreloadStartTime = FPlatformTime::Seconds();
+    PreloadAssets();
 }
 
 void UManagerHandlerSubsystem::ClearManagers() {
-    for (const auto& Pair : Managers) { Pair.Value->Deinitialize(); }
-    Managers.Empty();
+    // Managers still waiting on their assets were never initialized
+    if (bManagersReady) {
+        for (int32 Index = OrderedManagers.Num() - 1; Index >= 0; --Index) {
+            OrderedManagers[Index]->Deinitialize();
+        }
+    }
+    bManagersReady = false;
+    ManagersReadyCallbacks.Empty();
+
+    // Cancelled handles never fire, so a stale round cannot initialize the next manager set
+    for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles) {
+        if (Handle.IsValid()) { Handle->CancelHandle(); }
+    }
+    PreloadHandles.Empty();
+    RequestedAssets.Empty();
+    AdditionalPreloadAssets.Empty();
+
+    OrderedManagers.Empty();
+    InitializationLevels.Empty();
+    for (TArray<UManagerBase*>& Phase : PhaseManagers) { Phase.Empty(); }
+    ManagersBySlot.Empty();
+
+    // Jobs capture their managers, none may outlive them
+    for (const TUniquePtr<FManagerJob>& Job : Jobs) { Job->bFinished = true; }
+    CompactJobs();
 }
 
 void UManagerHandlerSubsystem::RefreshManagers() {
-    for (const auto& Pair : Managers) { Pair.Value->Deinitialize(); }
+    // Initialization is already pending on the preload
+    if (!bManagersReady) { return; }
+
+    for (int32 Index = OrderedManagers.Num() - 1; Index >= 0; --Index) {
+        OrderedManagers[Index]->Deinitialize();
+    }
+
+    InitializeManagers();
+}
+
+bool UManagerHandlerSubsystem::SortByDependencies(const TArray<UManagerBase*>& InManagers,
+                                                  TArray<TArray<UManagerBase*>>& OutLevels) {
+    OutLevels.Reset();
+
+    // Build the dependent lists and in-degrees, ignoring dependencies outside the set
+    TMap<UClass*, int32> IndexByClass;
+    for (int32 Index = 0; Index < InManagers.Num(); ++Index) {
+        IndexByClass.Add(InManagers[Index]->GetClass(), Index);
+    }
+
+    TArray<int32> InDegrees;
+    InDegrees.SetNumZeroed(InManagers.Num());
+    TArray<TArray<int32>> Dependents;
+    Dependents.SetNum(InManagers.Num());
+
+    TArray<TSubclassOf<UManagerBase>> Dependencies;
+    for (int32 Index = 0; Index < InManagers.Num(); ++Index) {
+        Dependencies.Reset();
+        InManagers[Index]->GetDependencies(Dependencies);
+        for (const TSubclassOf<UManagerBase>& Dependency : Dependencies) {
+            const int32* DependencyIndex = IndexByClass.Find(Dependency.Get());
+            if (!DependencyIndex || *DependencyIndex == Index) { continue; }
+
+            Dependents[*DependencyIndex].AddUnique(Index);
+            ++InDegrees[Index];
+        }
+    }
+
+    // Peel off managers with no unmet dependencies one level at a time
+    TArray<int32> CurrentLevel;
+    for (int32 Index = 0; Index < InManagers.Num(); ++Index) {
+        if (InDegrees[Index] == 0) { CurrentLevel.Add(Index); }
+    }
+
+    int32 SortedCount = 0;
+    while (!CurrentLevel.IsEmpty()) {
+        TArray<UManagerBase*>& Level = OutLevels.AddDefaulted_GetRef();
+        TArray<int32> NextLevel;
+        for (const int32 Index : CurrentLevel) {
+            Level.Add(InManagers[Index]);
+            for (const int32 Dependent : Dependents[Index]) {
+                if (--InDegrees[Dependent] == 0) { NextLevel.Add(Dependent); }
+            }
+        }
+
+        SortedCount += CurrentLevel.Num();
+        NextLevel.Sort();
+        CurrentLevel = MoveTemp(NextLevel);
+    }
+
+    if (SortedCount == InManagers.Num()) { return true; }
+
+    // Anything left still has unmet dependencies, so it is on or behind a cycle
+    for (int32 Index = 0; Index < InManagers.Num(); ++Index) {
+        if (InDegrees[Index] > 0) {
+            UE_LOG(LogTemp,
+                   Error,
+                   TEXT("Manager %s is part of or depends on a dependency cycle"),
+                   *InManagers[Index]->GetClass()->GetName());
+        }
+    }
+    return false;
+}
+
+void UManagerHandlerSubsystem::InitializeManagers() {
+    TArray<UManagerBase*> ConcurrentManagers;
+    for (const TArray<UManagerBase*>& Level : InitializationLevels) {
+        // Managers in one level never depend on each other, so opted-in ones can run in parallel
+        ConcurrentManagers.Reset();
+        for (UManagerBase* Manager : Level) {
+            if (Manager->SupportsConcurrentInitialize()) { ConcurrentManagers.Add(Manager); }
+        }
+
+        ParallelFor(ConcurrentManagers.Num(), [&ConcurrentManagers](const int32 Index) {
+            ConcurrentManagers[Index]->Initialize();
+        });
+
+        for (UManagerBase* Manager : Level) {
+            if (!Manager->SupportsConcurrentInitialize()) { Manager->Initialize(); }
+        }
+    }
+}
+
+void UManagerHandlerSubsystem::CallWhenManagersReady(FSimpleDelegate Callback) {
+    if (bManagersReady) {
+        Callback.ExecuteIfBound();
+        return;
+    }
+
+    ManagersReadyCallbacks.Add(MoveTemp(Callback));
+}
+
+void UManagerHandlerSubsystem::PreloadAssets() {
+    TArray<FSoftObjectPath> Assets;
+    GatherUnrequestedAssets(Assets);
+
+    // Each round can reveal more paths, e.g. a material referenced by a settings asset
+    while (!Assets.IsEmpty()) {
+        ++AssetLoadStats.NumRounds;
+        AssetLoadStats.NumAssets += Assets.Num();
+
+        if (CurrentAssetLoading == EManagerAssetLoading::Streamed) {
+            TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+                Assets,
+                FStreamableDelegate::CreateUObject(
+                    this,
+                    &UManagerHandlerSubsystem::OnPreloadRoundComplete),
+                FStreamableManager::AsyncLoadHighPriority);
+            if (Handle.IsValid()) {
+                PreloadHandles.Add(Handle);
+                return;
+            }
+        } else {
+            PreloadHandles.Add(StreamableManager.RequestSyncLoad(Assets));
+        }
+
+        GatherUnrequestedAssets(Assets);
+    }
+
+    FinishPreload();
+}
+
+void UManagerHandlerSubsystem::GatherUnrequestedAssets(TArray<FSoftObjectPath>& OutAssets) {
+    OutAssets.Reset();
+
+    TArray<FSoftObjectPath> Candidates = AdditionalPreloadAssets;
+    for (const UManagerBase* Manager : OrderedManagers) { Manager->GetAssetsToPreload(Candidates); }
+
+    for (const FSoftObjectPath& Asset : Candidates) {
+        bool bAlreadyRequested = false;
+        if (Asset.IsNull()) { continue; }
+        RequestedAssets.Add(Asset, &bAlreadyRequested);
+        if (!bAlreadyRequested) { OutAssets.Add(Asset); }
+    }
+}
+
+void UManagerHandlerSubsystem::OnPreloadRoundComplete() {
+    // Streamed rounds can complete during the request when everything is already resident
+    if (bManagersReady) { return; }
+
+    PreloadAssets();
+}
+
+void UManagerHandlerSubsystem::FinishPreload() {
+    AssetLoadStats.LoadSeconds = static_cast<float>(FPlatformTime::Seconds() - PreloadStartTime);
+    UE_LOG(LogTemp,
+           Log,
+           TEXT("ManagerHandlerSubsystem: %s %d manager assets in %d rounds, %.3fs"),
+           AssetLoadStats.bStreamed ? TEXT("Streamed") : TEXT("Loaded"),
+           AssetLoadStats.NumAssets,
+           AssetLoadStats.NumRounds,
+           AssetLoadStats.LoadSeconds);
+
+    InitializeManagers();
+    bManagersReady = true;
+
+    TArray<FSimpleDelegate> Callbacks = MoveTemp(ManagersReadyCallbacks);
+    for (const FSimpleDelegate& Callback : Callbacks) { Callback.ExecuteIfBound(); }
+}
+
+void UManagerHandlerSubsystem::TickPhase(const EManagerTickPhase Phase, const float DeltaTime) {
+    const TArray<UManagerBase*>& ManagersInPhase = PhaseManagers[static_cast<int32>(Phase)];
+    if (!bManagersReady || ManagersInPhase.IsEmpty()) { return; }
 
-    for (const auto& Pair : Managers) { Pair.Value->Initialize(); }
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_ManagerHandler_TickPhase);
+
+    TArray<UE::Tasks::FTask, TInlineAllocator<4>> WorkerTicks;
+    for (UManagerBase* Manager : ManagersInPhase) {
+        if (Manager->IsTickThreadSafe()) {
+            WorkerTicks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                                              [Manager, DeltaTime] {
+                                                  TickManager(*Manager, DeltaTime);
+                                              }));
+        }
+    }
+
+    for (UManagerBase* Manager : ManagersInPhase) {
+        if (!Manager->IsTickThreadSafe()) { TickManager(*Manager, DeltaTime); }
+    }
+
+    // Sync point - nothing after this phase may observe a half-ticked manager
+    UE::Tasks::Wait(WorkerTicks);
+}
+
+void UManagerHandlerSubsystem::TickManager(UManagerBase& Manager, const float DeltaTime) {
+    SCOPE_CYCLE_COUNTER_STATID(Manager.GetTickStatId());
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Manager.GetTraceName(), DDKnockoffChannel);
+    Manager.Tick(DeltaTime);
+}
+
+void UManagerHandlerSubsystem::UpdateMemoryStats() const {
+#if STATS
+    if (!FThreadStats::IsCollectingData()) { return; }
+
+    for (const UManagerBase* Manager : OrderedManagers) {
+        SET_MEMORY_STAT_FName(Manager->GetMemoryStatId().GetName(), Manager->GetAllocatedSize());
+    }
+    SET_DWORD_STAT(STAT_ManagerHandler_PendingJobs, JobStats.PendingJobs);
+#endif
+}
+
+void UManagerHandlerSubsystem::RegisterPhaseTickFunction(FManagerPhaseTickFunction& TickFunction,
+                                                         const EManagerTickPhase Phase,
+                                                         const ETickingGroup TickGroup) {
+    if (TickFunction.IsTickFunctionRegistered()) { return; }
+
+    UWorld* World = GetWorld();
+    if (!World || !World->PersistentLevel) { return; }
+
+    TickFunction.Handler = this;
+    TickFunction.Phase = Phase;
+    TickFunction.TickGroup = TickGroup;
+    TickFunction.EndTickGroup = TickGroup;
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.RegisterTickFunction(World->PersistentLevel);
+}
+
+FManagerJobHandle UManagerHandlerSubsystem::SubmitJob(const FName Name,
+                                                      const float BudgetMs,
+                                                      FManagerJobStep Step,
+                                                      const UObject* Owner) {
+    if (!ensureAlwaysMsgf(Step,
+                          TEXT("Manager job %s submitted without a step"),
+                          *Name.ToString())) { return FManagerJobHandle(); }
+
+    TUniquePtr<FManagerJob> Job = MakeUnique<FManagerJob>();
+    Job->Handle.Id = NextJobId++;
+    Job->Name = Name;
+    Job->BudgetMs = FMath::Max(0.0f, BudgetMs);
+    Job->Step = MoveTemp(Step);
+    Job->Owner = Owner;
+    Job->bHasOwner = Owner != nullptr;
+
+    const FManagerJobHandle Handle = Job->Handle;
+    Jobs.Add(MoveTemp(Job));
+    ++JobStats.PendingJobs;
+    return Handle;
+}
+
+bool UManagerHandlerSubsystem::CancelJob(const FManagerJobHandle Handle) {
+    const int32 Index = FindPendingJob(Handle);
+    if (Index == INDEX_NONE) { return false; }
+
+    Jobs[Index]->bFinished = true;
+    CompactJobs();
+    return true;
+}
+
+bool UManagerHandlerSubsystem::CompleteJob(const FManagerJobHandle Handle) {
+    const int32 Index = FindPendingJob(Handle);
+    if (Index == INDEX_NONE) { return false; }
+
+    FManagerJob& Job = *Jobs[Index];
+    if (!ensureAlwaysMsgf(!Job.bExecuting,
+                          TEXT("Manager job %s tried to complete itself"),
+                          *Job.Name.ToString())) { return false; }
+
+    while (!Job.bFinished) {
+        if (Job.bHasOwner && !Job.Owner.IsValid()) {
+            Job.bFinished = true;
+            break;
+        }
+        StepJob(Job);
+    }
+
+    CompactJobs();
+    return true;
+}
+
+bool UManagerHandlerSubsystem::IsJobPending(const FManagerJobHandle Handle) const {
+    return FindPendingJob(Handle) != INDEX_NONE;
+}
+
+void UManagerHandlerSubsystem::RunJobs() {
+    if (Jobs.IsEmpty() || bRunningJobs) { return; }
+
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_ManagerHandler_RunJobs);
+    bRunningJobs = true;
+    const double FrameStartTime = FPlatformTime::Seconds();
+
+    // Jobs submitted by a running step wait for the next frame
+    const int32 NumJobs = Jobs.Num();
+    for (int32 Index = 0; Index < NumJobs; ++Index) {
+        FManagerJob& Job = *Jobs[Index];
+        if (Job.bFinished) { continue; }
+        if (Job.bHasOwner && !Job.Owner.IsValid()) {
+            Job.bFinished = true;
+            continue;
+        }
+
+        // Always take one step, then only take another if it should fit in what is left
+        double ElapsedMs = 0.0;
+        do { ElapsedMs += StepJob(Job); } while (!Job.bFinished
+                                                 && ElapsedMs + Job.TotalStepMs / Job.StepCount
+                                                 <= Job.BudgetMs);
+
+        if (ElapsedMs > Job.BudgetMs) {
+            const float OverrunMs = static_cast<float>(ElapsedMs - Job.BudgetMs);
+            ++JobStats.BudgetOverruns;
+            JobStats.WorstOverrunMs = FMath::Max(JobStats.WorstOverrunMs, OverrunMs);
+            UE_LOG(LogTemp,
+                   Verbose,
+                   TEXT("Manager job %s overran its %.2fms budget by %.2fms"),
+                   *Job.Name.ToString(),
+                   Job.BudgetMs,
+                   OverrunMs);
+        }
+    }
+
+    JobStats.LastFrameMs = static_cast<float>((FPlatformTime::Seconds() - FrameStartTime) * 1000.0);
+    bRunningJobs = false;
+    CompactJobs();
+}
+
+int32 UManagerHandlerSubsystem::FindPendingJob(const FManagerJobHandle Handle) const {
+    if (!Handle.IsValid()) { return INDEX_NONE; }
+
+    return Jobs.IndexOfByPredicate([Handle](const TUniquePtr<FManagerJob>& Job) {
+        return Job->Handle == Handle && !Job->bFinished;
+    });
+}
+
+double UManagerHandlerSubsystem::StepJob(FManagerJob& Job) {
+    const double StepStartTime = FPlatformTime::Seconds();
+    EManagerJobStatus Status;
+    {
+        TGuardValue<bool> ExecutingGuard(Job.bExecuting, true);
+        Status = Job.Step();
+    }
+    const double StepMs = (FPlatformTime::Seconds() - StepStartTime) * 1000.0;
+
+    Job.TotalStepMs += StepMs;
+    ++Job.StepCount;
+
+    // A step may have cancelled its own job, which must not count as a completion
+    if (Status == EManagerJobStatus::Complete && !Job.bFinished) {
+        Job.bFinished = true;
+        ++JobStats.CompletedJobs;
+    }
+    return StepMs;
+}
+
+void UManagerHandlerSubsystem::CompactJobs() {
+    // Jobs stay in place while running so the running loop's references stay valid
+    if (!bRunningJobs) {
+        Jobs.RemoveAll([](const TUniquePtr<FManagerJob>& Job) { return Job->bFinished; });
+    }
+
+    JobStats.PendingJobs = Algo::CountIf(Jobs, [](const TUniquePtr<FManagerJob>& Job) {
+        return !Job->bFinished;
+    });
+}
+
+UManagerHandlerSubsystem* UManagerHandlerSubsystem::Get(const UWorld* World) {
+    if (!World) { return nullptr; }
+    if (World == CachedWorld) { return CachedSubsystem; }
+
+    UManagerHandlerSubsystem* Subsystem = World->GetSubsystem<UManagerHandlerSubsystem>();
+    if (Subsystem) {
+        CachedWorld = World;
+        CachedSubsystem = Subsystem;
+    }
+    return Subsystem;
 }
 
-void UManagerHandlerSubsystem::Deinitialize() { Super::Deinitialize(); }
+void UManagerHandlerSubsystem::Deinitialize() {
+    // A later world could reuse this world's address, so never hand out a dead subsystem
+    if (CachedSubsystem == this) {
+        CachedWorld = nullptr;
+        CachedSubsystem = nullptr;
+    }
+
+    if (PrePhysicsTickFunction.IsTickFunctionRegistered()) {
+        PrePhysicsTickFunction.UnRegisterTickFunction();
+    }
+    if (PostPhysicsTickFunction.IsTickFunctionRegistered()) {
+        PostPhysicsTickFunction.UnRegisterTickFunction();
+    }
+
+    Jobs.Reset();
+    JobStats.PendingJobs = 0;
+
+    for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles) {
+        if (Handle.IsValid()) { Handle->CancelHandle(); }
+    }
+    PreloadHandles.Empty();
+
+    Super::Deinitialize();
+}
 
 void UManagerHandlerSubsystem::Initialize(FSubsystemCollectionBase& Collection) {
     Super::Initialize(Collection);
 }
 
+#if !UE_BUILD_SHIPPING
+float UManagerHandlerSubsystem::GetSimulationTimeStep() {
+    // Match the engine's own fixed step when running with -UseFixedTimeStep -FPS=
+    if (FApp::UseFixedTimeStep() && FApp::GetFixedDeltaTime() > 0.0) {
+        return static_cast<float>(FApp::GetFixedDeltaTime());
+    }
+
+    const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get();
+    return GameSettings && GameSettings->SimulationTimeStep > 0.0f
+               ? GameSettings->SimulationTimeStep
+               : 1.0f / 30.0f;
+}
+
+int32 UManagerHandlerSubsystem::Simulate(const float Seconds, const float StepSeconds) {
+    UWorld* World = GetWorld();
+    if (!World || Seconds <= 0.0f) { return 0; }
+    if (!ensureAlwaysMsgf(!World->bInTick,
+                          TEXT("Cannot fast-forward a world from inside its own tick"))) {
+        return 0;
+    }
+
+    const float Step = StepSeconds > 0.0f ? StepSeconds : GetSimulationTimeStep();
+    // Tolerate float error so e.g. 1s at 0.1s steps is 10 ticks, not 11
+    const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(Seconds / Step - KINDA_SMALL_NUMBER));
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex) {
+        World->Tick(LEVELTICK_All, Step);
+        // Tick functions queue once per frame counter, so every step needs its own frame
+        ++GFrameCounter;
+    }
+    const double RealSeconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogTemp,
+           Log,
+           TEXT("Simulated %.2fs in %d steps of %.4fs, took %.2fs (%.1fx real time)"),
+           NumSteps * Step,
+           NumSteps,
+           Step,
+           RealSeconds,
+           RealSeconds > 0.0 ? NumSteps * Step / RealSeconds : 0.0);
+    return NumSteps;
+}
+#endif
+
 void UManagerHandlerSubsystem::Tick(float DeltaTime) {
-    for (const auto& Pair : Managers) { Pair.Value->Tick(DeltaTime); }
+    TickPhase(EManagerTickPhase::Late, DeltaTime);
+    RunJobs();
+    UpdateMemoryStats();
 }
 
 TStatId UManagerHandlerSubsystem::GetStatId() const {
-    RETURN_QUICK_DECLARE_CYCLE_STAT(UManagerHandlerSubsystem, STATGROUP_Tickables);
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UManagerHandlerSubsystem, STATGROUP_DDKnockoff);
 }
@@ -1,8 +1,12 @@
 ﻿#include "Crystal/CrystalAnimInstance.h"
 
+#include "Engine/World.h"
+
 void UCrystalAnimInstance::UpdateAnimationProperties(float DeltaTime) {
-    // Use the current game time for the sine wave to avoid accumulating float imprecisions
-    const double GameTime = FPlatformTime::Seconds();
+    // Use world time for the sine wave to avoid accumulating float imprecisions, and so the bob
+    // follows a fixed-step simulation rather than the wall clock
+    const UWorld* World = GetWorld();
+    const double GameTime = World ? World->GetTimeSeconds() : 0.0;
 
     // Calculate bobbing motion using a sine wave
     CurrentVerticalOffset = FMath::Sin(GameTime * BobSpeed) * BobHeight;
@@ -91,8 +91,8 @@ void ACrystalStructure::BeginPlay() {
     // Validate configuration
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     AnimInstance = Cast<UCrystalAnimInstance>(SkeletonMesh->GetAnimInstance());
     ensureAlways(AnimInstance != nullptr);
@@ -109,8 +109,8 @@ void ACrystalStructure::Tick(float DeltaTime) {
 }
 
 void ACrystalStructure::EndPlay(EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
 
     Super::EndPlay(EndPlayReason);
 }
@@ -119,6 +119,7 @@ EFaction ACrystalStructure::GetFaction() const { return EFaction::Player; }
 AActor* ACrystalStructure::GetActor() { return this; }
 UEntityData* ACrystalStructure::GetEntityData() const { return EntityData; }
 EEntityType ACrystalStructure::GetEntityType() const { return EEntityType::Structure_Crystal; }
+void ACrystalStructure::ResetEntity() { HealthComponent->ResetHealth(); }
 
 // IDependencyInjectable interface implementation
 bool ACrystalStructure::HasRequiredDependencies() const { return EntityManager != nullptr; }
@@ -32,7 +32,7 @@ ACurrencyCrystal::ACurrencyCrystal() {
 void ACurrencyCrystal::BeginPlay() {
     Super::BeginPlay();
 
-    SpawnTimestamp = FPlatformTime::Seconds();
+    SpawnTimestamp = GetWorld()->GetTimeSeconds();
 }
 
 // Called every frame
@@ -41,7 +41,7 @@ void ACurrencyCrystal::Tick(float DeltaTime) { Super::Tick(DeltaTime); }
 UStaticMeshComponent* ACurrencyCrystal::GetMesh() const { return CrystalMesh; }
 
 float ACurrencyCrystal::GetCurrentAttractionSubjectivity() const {
-    const auto timeElapsed = FPlatformTime::Seconds() - SpawnTimestamp;
+    const auto timeElapsed = GetWorld()->GetTimeSeconds() - SpawnTimestamp;
 
     // If no curve is set, default to linear behavior
     if (!AttractionResistanceCurve) { return FMath::Clamp(timeElapsed, 0.0f, 1.0f); }
@@ -1,5 +1,6 @@
 #include "Currency/CurrencyManager.h"
 #include "Core/ConfigurationValidatable.h"
+#include "Core/DDKnockoffStats.h"
 
 UCurrencyManager::UCurrencyManager() {
     // Constructor implementation
@@ -36,6 +37,8 @@ void UCurrencyManager::SortCrystalTypes() const {
 TArray<FCurrencySpawnInfo> UCurrencyManager::CalculateCurrencySpawnInfo(
     int32 TotalCurrencyAmount,
     int32 MinimumCrystalCount) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CurrencyManager_CalculateCurrencySpawnInfo);
+
     TArray<FCurrencySpawnInfo> Result;
 
     if (TotalCurrencyAmount <= 0 || !Settings || Settings->AvailableCurrencyCrystals.Num() == 0) {
@@ -90,6 +90,7 @@ FDamagePayload UDamageUtils::CreateDamagePayload(float DamageAmount,
         if (InstigatorEntity) {
             DamagePayload.DamageInstigator.SetInterface(InstigatorEntity);
             DamagePayload.DamageInstigator.SetObject(Instigator);
+            DamagePayload.InstigatorHandle = InstigatorEntity->GetEntityHandle();
         }
     }
 
@@ -4,6 +4,7 @@
 #include "Engine/World.h"
 #include "Blueprint/UserWidget.h"
 #include "Core/DDKnockoffGameSettings.h"
+#include "Core/DDKnockoffStats.h"
 
 void UDebugInformationManager::Initialize() {
     bIsInitialized = true;
@@ -27,8 +28,9 @@ void UDebugInformationManager::Deinitialize() {
     // Clean up widget
     DestroyDebugWidget();
 
-    // Clear providers
-    DebugInformationProviders.Empty();
+    // Keep every other provider so a manager refresh doesn't silently drop actors that
+    // registered at BeginPlay - they unregister themselves at EndPlay
+    UnregisterDebugInformationProvider(this);
 
     bIsInitialized = false;
 
@@ -87,6 +89,17 @@ void UDebugInformationManager::Tick(float DeltaTime) {
     }
 }
 
+void UDebugInformationManager::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const {
+    if (const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get()) {
+        OutAssets.Add(GameSettings->DebugInformationSettingsAsset);
+    }
+}
+
+SIZE_T UDebugInformationManager::GetAllocatedSize() const {
+    return DebugInformationProviders.GetAllocatedSize() + SubsystemDebugCategory.GetAllocatedSize()
+           + SubsystemDebugInformation.GetAllocatedSize();
+}
+
 void UDebugInformationManager::LoadSettings() {
     // Load settings path from game settings
     const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get();
@@ -95,6 +108,7 @@ void UDebugInformationManager::LoadSettings() {
             GameSettings->DebugInformationSettingsAsset);
 
         if (DebugSettingsAsset.IsValid() || DebugSettingsAsset.IsPending()) {
+            // No-op load when the manager handler has streamed the asset in
             DebugSettings = DebugSettingsAsset.LoadSynchronous();
             if (DebugSettings) {
                 DebugSettings->ValidateConfiguration();
@@ -185,6 +199,8 @@ void UDebugInformationManager::UpdateDebugInformationWidget() {
         return; // No widget to update
     }
 
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_DebugInformationManager_UpdateWidget);
+
     FString DebugInfoString;
 
     for (const TScriptInterface<IDebugInformationProvider>& Provider : DebugInformationProviders) {
@@ -0,0 +1,353 @@
+#include "Enemies/AIDirectorManager.h"
+
+#include "Async/ParallelFor.h"
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Crystal/CrystalStructure.h"
+#include "Debug/DebugInformationManager.h"
+#include "Enemies/AISignificanceManager.h"
+#include "Enemies/CrystalPathFieldManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/EngagementManager.h"
+#include "Engine/World.h"
+#include "Entities/EntityManager.h"
+#include "NavigationSystem.h"
+
+void UAIDirectorManager::Initialize() {
+    EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(GetWorld());
+    CrystalPathField = UManagerHandlerSubsystem::GetManager<UCrystalPathFieldManager>(GetWorld());
+    Engagement = UManagerHandlerSubsystem::GetManager<UEngagementManager>(GetWorld());
+
+    // Agents survive a manager refresh, but start deciding from scratch
+    for (int32 AgentIndex = Controllers.Num() - 1; AgentIndex >= 0; --AgentIndex) {
+        if (!Controllers[AgentIndex].IsValid()) {
+            RemoveAgentAt(AgentIndex);
+            continue;
+        }
+        States[AgentIndex] = EEnemyAIState::None;
+        Targets[AgentIndex].Reset();
+        NextRetargetTimes[AgentIndex] = 0.0;
+        NextDecisionTimes[AgentIndex] = 0.0;
+        Engaged[AgentIndex] = false;
+    }
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UAIDirectorManager::Deinitialize() {
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+
+    // Keep agents, controllers register once at BeginPlay and unregister themselves at EndPlay
+    EntityManager = nullptr;
+    CrystalPathField = nullptr;
+    Engagement = nullptr;
+}
+
+void UAIDirectorManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UEntityManager::StaticClass());
+    OutDependencies.Add(UCrystalPathFieldManager::StaticClass());
+    OutDependencies.Add(UEngagementManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+void UAIDirectorManager::Tick(const float DeltaTime) {
+    if (Controllers.IsEmpty()) { return; }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    GatherAgentState(Now);
+
+    {
+        DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_AIDirector_Decide);
+        const int32 NumAgents = Controllers.Num();
+        ParallelFor(NumAgents,
+                    [this, Now](const int32 AgentIndex) { DecideAgent(AgentIndex, Now); },
+                    NumAgents < ParallelDecisionThreshold);
+    }
+
+    ApplyCommands();
+
+    LastUpdateMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UAIDirectorManager::RegisterAgent(ADDAIController* Controller) {
+    if (!Controller || FindAgent(Controller) != INDEX_NONE) { return; }
+
+    AgentIndices.Add(Controller, Controllers.Num());
+    Controllers.Add(Controller);
+    ControllerKeys.Add(Controller);
+    States.Add(EEnemyAIState::None);
+    Targets.AddDefaulted();
+    NextRetargetTimes.Add(0.0);
+    RetargetIntervals.Add(Controller->GetTargetUpdateInterval());
+    NextDecisionTimes.Add(0.0);
+    Commands.Add(EAIDirectorCommand::None);
+    CanDecide.Add(false);
+    OverlappingDefense.Add(false);
+    PathIdle.Add(false);
+    TargetValid.Add(false);
+    ClosestOverlaps.AddDefaulted();
+    Engaged.Add(false);
+}
+
+void UAIDirectorManager::UnregisterAgent(ADDAIController* Controller) {
+    if (Engagement) { Engagement->ReleaseSlot(Controller); }
+
+    const int32 AgentIndex = FindAgent(Controller);
+    if (AgentIndex != INDEX_NONE) { RemoveAgentAt(AgentIndex); }
+}
+
+bool UAIDirectorManager::IsAgentRegistered(const ADDAIController* Controller) const {
+    return FindAgent(Controller) != INDEX_NONE;
+}
+
+void UAIDirectorManager::ClearTarget(const ADDAIController* Controller) {
+    const int32 AgentIndex = FindAgent(Controller);
+    if (AgentIndex != INDEX_NONE) { Targets[AgentIndex].Reset(); }
+}
+
+void UAIDirectorManager::WakeAgent(const ADDAIController* Controller) {
+    const int32 AgentIndex = FindAgent(Controller);
+    if (AgentIndex != INDEX_NONE) { NextDecisionTimes[AgentIndex] = 0.0; }
+}
+
+FEntityHandle UAIDirectorManager::GetTarget(const ADDAIController* Controller) const {
+    const int32 AgentIndex = FindAgent(Controller);
+    return AgentIndex != INDEX_NONE ? Targets[AgentIndex] : FEntityHandle();
+}
+
+EEnemyAIState UAIDirectorManager::GetState(const ADDAIController* Controller) const {
+    const int32 AgentIndex = FindAgent(Controller);
+    return AgentIndex != INDEX_NONE ? States[AgentIndex] : EEnemyAIState::None;
+}
+
+void UAIDirectorManager::GatherAgentState(const double Now) {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_AIDirector_Gather);
+
+    LastDecidingAgents = 0;
+    for (int32 AgentIndex = Controllers.Num() - 1; AgentIndex >= 0; --AgentIndex) {
+        const ADDAIController* Controller = Controllers[AgentIndex].Get();
+        if (!Controller) {
+            RemoveAgentAt(AgentIndex);
+            continue;
+        }
+
+        // Less significant agents sit out frames, skipping the gather as well as the decision
+        const bool bCanDecide = Now >= NextDecisionTimes[AgentIndex]
+                                && Controller->CanMakeDecisions();
+        CanDecide[AgentIndex] = bCanDecide;
+        if (!bCanDecide) { continue; }
+
+        ++LastDecidingAgents;
+        const ADDAICharacter* AICharacter = Controller->GetAICharacter();
+        NextDecisionTimes[AgentIndex] = Now + UAISignificanceManager::GetTierSettings(
+            AICharacter->GetSignificanceTier()).DecisionInterval;
+        const bool bOverlapping = AICharacter->GetActorOverlapState()
+                                  == CharacterActorOverlapState::OverlappingStructure;
+        OverlappingDefense[AgentIndex] = bOverlapping;
+        ClosestOverlaps[AgentIndex] = bOverlapping
+                                          ? AICharacter->GetClosestOverlappingStructure()
+                                          : FEntityHandle();
+        PathIdle[AgentIndex] = Controller->IsPathComponentIdle();
+        TargetValid[AgentIndex] = EntityManager
+                                  && EntityManager->ResolveActor(Targets[AgentIndex]) != nullptr;
+    }
+}
+
+void UAIDirectorManager::DecideAgent(const int32 AgentIndex, const double Now) {
+    EAIDirectorCommand Command = EAIDirectorCommand::None;
+    ON_SCOPE_EXIT { Commands[AgentIndex] = Command; };
+
+    if (!CanDecide[AgentIndex]) { return; }
+
+    const bool bOverlapping = OverlappingDefense[AgentIndex];
+    const FEntityHandle ClosestOverlap = ClosestOverlaps[AgentIndex];
+    // Read once - bit arrays share words between agents, so they are never written here
+    bool bTargetValid = TargetValid[AgentIndex];
+    FEntityHandle& Target = Targets[AgentIndex];
+    EEnemyAIState& State = States[AgentIndex];
+
+    // Periodic retarget - an overlapped defense wins outright, a crystal search needs the
+    // navigation system so it is left to the apply pass
+    if (Now >= NextRetargetTimes[AgentIndex]) {
+        NextRetargetTimes[AgentIndex] = Now + RetargetIntervals[AgentIndex];
+        if (bOverlapping) {
+            Target = ClosestOverlap;
+            bTargetValid = true;
+        } else { Command |= EAIDirectorCommand::FindTarget; }
+    }
+
+    switch (State) {
+        case EEnemyAIState::None:
+            State = EEnemyAIState::MovingTowardsTarget;
+            break;
+        case EEnemyAIState::MovingTowardsTarget:
+            if (!bTargetValid) {
+                Command |= EAIDirectorCommand::StopMovement | EAIDirectorCommand::MoveToTarget;
+                if (bOverlapping) { Target = ClosestOverlap; } else {
+                    Command |= EAIDirectorCommand::FindTarget;
+                }
+            } else if (bOverlapping) {
+                // Prioritize attacking the closest defense we are touching
+                Target = ClosestOverlap;
+                Command |= EAIDirectorCommand::StopMovement;
+                State = EEnemyAIState::AttackingTarget;
+            } else if (PathIdle[AgentIndex]) { Command |= EAIDirectorCommand::MoveToTarget; }
+            break;
+        case EEnemyAIState::AttackingTarget:
+            if (!bTargetValid) {
+                State = EEnemyAIState::MovingTowardsTarget;
+            } else if (bOverlapping) {
+                Target = ClosestOverlap;
+                Command |= EAIDirectorCommand::Attack;
+            } else { State = EEnemyAIState::MovingTowardsTarget; }
+            break;
+        default: ;
+    }
+}
+
+void UAIDirectorManager::ApplyCommands() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_AIDirector_Apply);
+
+    LastTargetSearches = 0;
+    for (int32 AgentIndex = 0; AgentIndex < Controllers.Num(); ++AgentIndex) {
+        ADDAIController* Controller = Controllers[AgentIndex].Get();
+        if (!Controller) { continue; }
+
+        // Leaving the attack state frees the slot, or the place in queue, for the next enemy
+        if (Engaged[AgentIndex] && States[AgentIndex] != EEnemyAIState::AttackingTarget) {
+            Engaged[AgentIndex] = false;
+            if (Engagement) { Engagement->ReleaseSlot(Controller); }
+        }
+
+        const EAIDirectorCommand Command = Commands[AgentIndex];
+        if (Command == EAIDirectorCommand::None) { continue; }
+
+        if (EnumHasAnyFlags(Command, EAIDirectorCommand::StopMovement)) {
+            Controller->StopPathingAndMovement();
+        }
+        if (EnumHasAnyFlags(Command, EAIDirectorCommand::FindTarget)) {
+            Targets[AgentIndex] = FindCrystalTarget(*Controller);
+            ++LastTargetSearches;
+        }
+
+        AActor* TargetActor = EntityManager ? EntityManager->ResolveActor(Targets[AgentIndex])
+                                            : nullptr;
+        if (!TargetActor) { continue; }
+
+        if (EnumHasAnyFlags(Command, EAIDirectorCommand::MoveToTarget)) {
+            Controller->MoveToTarget(*TargetActor);
+        }
+        if (EnumHasAnyFlags(Command, EAIDirectorCommand::Attack)) {
+            // Enemies without a slot hold position until one frees up
+            Engaged[AgentIndex] = Engagement != nullptr;
+            if (!Engagement || Engagement->RequestSlot(Controller, Targets[AgentIndex])) {
+                Controller->AttackIfAble(*TargetActor);
+            }
+        }
+    }
+}
+
+FEntityHandle UAIDirectorManager::FindCrystalTarget(const ADDAIController& Controller) const {
+    const APawn* Pawn = Controller.GetPawn();
+    if (!EntityManager || !Pawn) { return FEntityHandle(); }
+
+    // One field sample replaces a path query per crystal once the field has been built
+    if (CrystalPathField && CrystalPathField->IsFieldReady()) {
+        const FEntityHandle Crystal = CrystalPathField->FindNearestCrystal(
+            Pawn->GetActorLocation());
+        if (Crystal.IsValid()) { return Crystal; }
+    }
+
+    // Fall back to querying every crystal while the field is building or cannot see the pawn
+    const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+        GetWorld());
+    if (!NavSys) { return FEntityHandle(); }
+
+    const FEntityView Crystals = EntityManager->ViewEntitiesByType(EEntityType::Structure_Crystal);
+
+    FEntityHandle NearestCrystal;
+    float SmallestPathCost = FLT_MAX;
+
+    for (int i = 0; i < Crystals.Num(); ++i) {
+        const TScriptInterface<IEntity>& CrystalEntity = Crystals[i];
+        if (!CrystalEntity.GetObject() || !IsValid(CrystalEntity.GetObject())) { continue; }
+
+        const ACrystalStructure* Crystal = Cast<ACrystalStructure>(CrystalEntity->GetActor());
+        if (!Crystal) { continue; }
+
+        Chaos::FReal PathCost = 0.0f;
+        NavSys->GetPathCost(Pawn->GetActorLocation(), Crystal->GetActorLocation(), PathCost);
+
+        if (PathCost < SmallestPathCost) {
+            SmallestPathCost = PathCost;
+            NearestCrystal = CrystalEntity->GetEntityHandle();
+        }
+    }
+
+    return NearestCrystal;
+}
+
+void UAIDirectorManager::RemoveAgentAt(const int32 AgentIndex) {
+    const int32 LastIndex = Controllers.Num() - 1;
+    AgentIndices.Remove(ControllerKeys[AgentIndex]);
+    if (AgentIndex != LastIndex) { AgentIndices.Add(ControllerKeys[LastIndex], AgentIndex); }
+
+    Controllers.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    ControllerKeys.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    States.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    Targets.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    NextRetargetTimes.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    RetargetIntervals.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    NextDecisionTimes.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    Commands.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    ClosestOverlaps.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+
+    // TBitArray has no swap-removal, so move the last bit down by hand
+    for (TBitArray<>* Bits :
+         {&CanDecide, &OverlappingDefense, &PathIdle, &TargetValid, &Engaged}) {
+        if (AgentIndex != LastIndex) { (*Bits)[AgentIndex] = (*Bits)[LastIndex]; }
+        Bits->RemoveAt(LastIndex);
+    }
+}
+
+int32 UAIDirectorManager::FindAgent(const ADDAIController* Controller) const {
+    const int32* AgentIndex = AgentIndices.Find(Controller);
+    return AgentIndex ? *AgentIndex : INDEX_NONE;
+}
+
+SIZE_T UAIDirectorManager::GetAllocatedSize() const {
+    return Controllers.GetAllocatedSize() + ControllerKeys.GetAllocatedSize()
+           + States.GetAllocatedSize() + Targets.GetAllocatedSize()
+           + NextRetargetTimes.GetAllocatedSize() + RetargetIntervals.GetAllocatedSize()
+           + NextDecisionTimes.GetAllocatedSize()
+           + Commands.GetAllocatedSize() + CanDecide.GetAllocatedSize()
+           + OverlappingDefense.GetAllocatedSize() + PathIdle.GetAllocatedSize()
+           + TargetValid.GetAllocatedSize() + ClosestOverlaps.GetAllocatedSize()
+           + Engaged.GetAllocatedSize() + AgentIndices.GetAllocatedSize();
+}
+
+FString UAIDirectorManager::GetDebugCategory() const { return TEXT("AI Director"); }
+
+FString UAIDirectorManager::GetDebugInformation() const {
+    int32 StateCounts[static_cast<int32>(EEnemyAIState::MAX)] = {};
+    for (const EEnemyAIState State : States) { ++StateCounts[static_cast<int32>(State)]; }
+
+    return FString::Printf(
+        TEXT("Agents: %d (%d deciding)\nMoving: %d\nAttacking: %d\nTarget Searches: %d\n"
+            "Update: %.3fms"),
+        Controllers.Num(),
+        LastDecidingAgents,
+        StateCounts[static_cast<int32>(EEnemyAIState::MovingTowardsTarget)],
+        StateCounts[static_cast<int32>(EEnemyAIState::AttackingTarget)],
+        LastTargetSearches,
+        LastUpdateMs);
+}
@@ -0,0 +1,206 @@
+#include "Enemies/AISignificanceManager.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/EngagementManager.h"
+#include "Engine/World.h"
+#include "Entities/EntityManager.h"
+#include "GameFramework/PlayerController.h"
+
+namespace {
+    // Decision, overlap poll, animation and movement intervals for each tier
+    const FAISignificanceTierSettings TierSettings[] = {
+        {0.0f, 0.0f, 0.0f, 0.0f},
+        {0.2f, 0.1f, 1.0f / 30.0f, 1.0f / 30.0f},
+        {0.5f, 0.25f, 0.1f, 0.1f},
+    };
+
+    static_assert(UE_ARRAY_COUNT(TierSettings) == static_cast<int32>(EAISignificanceTier::MAX),
+                  "Every significance tier needs settings");
+}
+
+void UAISignificanceManager::Initialize() {
+    EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(GetWorld());
+    Engagement = UManagerHandlerSubsystem::GetManager<UEngagementManager>(GetWorld());
+    EvaluationCursor = 0;
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UAISignificanceManager::Deinitialize() {
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+
+    // Nothing re-evaluates enemies without the manager, so put them all back to full rate
+    if (EntityManager) {
+        for (const TScriptInterface<IEntity>& Entity : EntityManager->ViewEntitiesByFactionAndType(
+                 EFaction::Enemy,
+                 EEntityType::Character)) {
+            if (ADDAICharacter* Character = Cast<ADDAICharacter>(Entity.GetObject())) {
+                Character->SetSignificanceTier(EAISignificanceTier::High);
+            }
+        }
+    }
+
+    EntityManager = nullptr;
+    Engagement = nullptr;
+    ViewLocations.Empty();
+}
+
+void UAISignificanceManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UEntityManager::StaticClass());
+    OutDependencies.Add(UEngagementManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+void UAISignificanceManager::Tick(const float DeltaTime) {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_AISignificance_Evaluate);
+
+    LastEvaluations = 0;
+    LastTierChanges = 0;
+    if (!EntityManager) { return; }
+
+    const FEntityView Enemies = EntityManager->ViewEntitiesByFactionAndType(
+        EFaction::Enemy,
+        EEntityType::Character);
+    if (Enemies.IsEmpty()) { return; }
+
+    GatherViewLocations();
+
+    // Pick up where the last frame stopped, wrapping so the whole population gets visited
+    const int32 NumEvaluations = FMath::Min(Enemies.Num(), MaxEvaluationsPerFrame);
+    for (int32 Step = 0; Step < NumEvaluations; ++Step) {
+        EvaluationCursor = EvaluationCursor % Enemies.Num();
+        ADDAICharacter* Character = Cast<ADDAICharacter>(Enemies[EvaluationCursor++].GetObject());
+        if (!Character) { continue; }
+
+        const EAISignificanceTier Tier = EvaluateTier(*Character, ViewLocations);
+        if (Tier != Character->GetSignificanceTier()) {
+            Character->SetSignificanceTier(Tier);
+            ++LastTierChanges;
+        }
+        ++LastEvaluations;
+    }
+}
+
+const FAISignificanceTierSettings& UAISignificanceManager::GetTierSettings(
+    const EAISignificanceTier Tier) {
+    const int32 TierIndex = static_cast<int32>(Tier);
+    return TierSettings[ensureAlways(TierIndex < UE_ARRAY_COUNT(TierSettings)) ? TierIndex : 0];
+}
+
+EAISignificanceTier UAISignificanceManager::EvaluateTier(
+    const ADDAICharacter& Character,
+    const TConstArrayView<FVector> CameraLocations) const {
+    // Waiting for an attack slot is standing still, the engagement wakes the enemy when its
+    // turn comes
+    const ADDAIController* Controller = Cast<ADDAIController>(Character.GetController());
+    if (Engagement && Engagement->IsWaitingForSlot(Controller)) {
+        return EAISignificanceTier::Low;
+    }
+
+    // Anything touching a structure is fighting, and fights run at full rate
+    if (Character.GetActorOverlapState() == CharacterActorOverlapState::OverlappingStructure) {
+        return EAISignificanceTier::High;
+    }
+
+    const FVector Location = Character.GetActorLocation();
+    const float StructureDistance = GetDistanceToNearestStructure(Location);
+    if (StructureDistance <= HighStructureDistance) { return EAISignificanceTier::High; }
+
+    double ViewDistanceSquared = TNumericLimits<double>::Max();
+    for (const FVector& CameraLocation : CameraLocations) {
+        ViewDistanceSquared = FMath::Min(ViewDistanceSquared,
+                                         FVector::DistSquared(CameraLocation, Location));
+    }
+
+    const USkeletalMeshComponent* Mesh = Character.GetMesh();
+    const bool bOnScreen = Mesh && Mesh->WasRecentlyRendered(OnScreenTimeTolerance);
+    if (bOnScreen && ViewDistanceSquared <= FMath::Square(HighViewDistance)) {
+        return EAISignificanceTier::High;
+    }
+
+    if (bOnScreen || StructureDistance <= MediumStructureDistance
+        || ViewDistanceSquared <= FMath::Square(MediumViewDistance)) {
+        return EAISignificanceTier::Medium;
+    }
+
+    return EAISignificanceTier::Low;
+}
+
+float UAISignificanceManager::GetDistanceToNearestStructure(const FVector& Location) const {
+    if (!EntityManager) { return FLT_MAX; }
+
+    const FEntityHotData& HotData = EntityManager->GetHotData();
+    float ClosestDistance = FLT_MAX;
+
+    TArray<FEntityHandle> Handles;
+    for (const EEntityType Type : {EEntityType::Structure_Defense, EEntityType::Structure_Crystal}) {
+        FEntityQueryFilter Filter;
+        Filter.Faction = EFaction::Player;
+        Filter.Type = Type;
+        Filter.bTargetableOnly = true;
+
+        Handles.Reset();
+        EntityManager->FindNearest(Filter, Location, 1, Handles, MediumStructureDistance);
+        if (Handles.IsEmpty()) { continue; }
+
+        const int32 HotIndex = EntityManager->GetHotIndex(Handles[0]);
+        if (HotIndex == INDEX_NONE) { continue; }
+
+        ClosestDistance = FMath::Min(ClosestDistance,
+                                     static_cast<float>(FVector::Dist(
+                                         HotData.Positions[HotIndex],
+                                         Location)));
+    }
+
+    return ClosestDistance;
+}
+
+void UAISignificanceManager::GatherViewLocations() {
+    ViewLocations.Reset();
+
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It) {
+        const APlayerController* PlayerController = It->Get();
+        if (!PlayerController || !PlayerController->IsLocalController()) { continue; }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        ViewLocations.Add(ViewLocation);
+    }
+}
+
+FString UAISignificanceManager::GetDebugCategory() const { return TEXT("AI Significance"); }
+
+FString UAISignificanceManager::GetDebugInformation() const {
+    int32 TierCounts[static_cast<int32>(EAISignificanceTier::MAX)] = {};
+    if (EntityManager) {
+        for (const TScriptInterface<IEntity>& Entity : EntityManager->ViewEntitiesByFactionAndType(
+                 EFaction::Enemy,
+                 EEntityType::Character)) {
+            if (const ADDAICharacter* Character = Cast<ADDAICharacter>(Entity.GetObject())) {
+                ++TierCounts[static_cast<int32>(Character->GetSignificanceTier())];
+            }
+        }
+    }
+
+    return FString::Printf(
+        TEXT("High: %d\nMedium: %d\nLow: %d\nEvaluated: %d\nTier Changes: %d\nCameras: %d"),
+        TierCounts[static_cast<int32>(EAISignificanceTier::High)],
+        TierCounts[static_cast<int32>(EAISignificanceTier::Medium)],
+        TierCounts[static_cast<int32>(EAISignificanceTier::Low)],
+        LastEvaluations,
+        LastTierChanges,
+        ViewLocations.Num());
+}
@@ -0,0 +1,216 @@
+#include "Enemies/CrystalPathField.h"
+
+namespace {
+    constexpr int32 NumNeighbours = 8;
+    constexpr int32 NeighbourOffsets[NumNeighbours][2] = {
+        {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}
+    };
+}
+
+void FCrystalPathField::Reset(const FBox& Bounds, const float InCellSize) {
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    Origin = FVector2D(Bounds.Min.X, Bounds.Min.Y);
+    GridZ = Bounds.GetCenter().Z;
+    GridSize = FIntPoint(FMath::Max(1, FMath::CeilToInt(Bounds.GetSize().X / CellSize)),
+                         FMath::Max(1, FMath::CeilToInt(Bounds.GetSize().Y / CellSize)));
+
+    CellCosts.Init(1.0f, GridSize.X * GridSize.Y);
+    ResetSolve();
+}
+
+void FCrystalPathField::ResetSolve() {
+    Distances.Reset();
+    NearestSources.Reset();
+    SourceHandles.Reset();
+    PendingDistances.Reset();
+    PendingNearestSources.Reset();
+    PendingSourceHandles.Reset();
+    PendingSourceCells.Reset();
+    OpenCells.Reset();
+    bSolving = false;
+}
+
+int32 FCrystalPathField::GetCellIndex(const FVector& Location) const {
+    const int32 X = FMath::FloorToInt((Location.X - Origin.X) / CellSize);
+    const int32 Y = FMath::FloorToInt((Location.Y - Origin.Y) / CellSize);
+    if (X < 0 || Y < 0 || X >= GridSize.X || Y >= GridSize.Y) { return INDEX_NONE; }
+    return Y * GridSize.X + X;
+}
+
+FVector FCrystalPathField::GetCellCenter(const int32 CellIndex) const {
+    const int32 X = CellIndex % GridSize.X;
+    const int32 Y = CellIndex / GridSize.X;
+    return FVector(Origin.X + (X + 0.5) * CellSize, Origin.Y + (Y + 0.5) * CellSize, GridZ);
+}
+
+void FCrystalPathField::SetCellCost(const int32 CellIndex, const float Cost) {
+    CellCosts[CellIndex] = Cost == BlockedCost ? BlockedCost : FMath::Max(Cost, 0.0f);
+}
+
+void FCrystalPathField::CopyCosts(const FCrystalPathField& Other) {
+    const bool bSameGrid = Origin == Other.Origin && CellSize == Other.CellSize
+                           && GridSize == Other.GridSize;
+    Origin = Other.Origin;
+    GridZ = Other.GridZ;
+    CellSize = Other.CellSize;
+    GridSize = Other.GridSize;
+    CellCosts = Other.CellCosts;
+
+    if (!bSameGrid) { ResetSolve(); }
+}
+
+void FCrystalPathField::Solve(const TConstArrayView<FSource> Sources) {
+    BeginSolve(Sources);
+    StepSolve(MAX_int32);
+}
+
+void FCrystalPathField::BeginSolve(const TConstArrayView<FSource> Sources) {
+    PendingDistances.Init(MAX_flt, CellCosts.Num());
+    PendingNearestSources.Init(INDEX_NONE, CellCosts.Num());
+    PendingSourceHandles.Reset(Sources.Num());
+    PendingSourceCells.Init(false, CellCosts.Num());
+    OpenCells.Reset();
+    bSolving = true;
+
+    for (const FSource& Source : Sources) {
+        const int32 CellIndex = GetCellIndex(Source.Location);
+        if (CellIndex == INDEX_NONE || IsBlocked(CellIndex) || PendingSourceCells[CellIndex]) {
+            continue;
+        }
+
+        PendingDistances[CellIndex] = 0.0f;
+        PendingNearestSources[CellIndex] = PendingSourceHandles.Add(Source.Handle);
+        PendingSourceCells[CellIndex] = true;
+        OpenCells.HeapPush({0.0f, CellIndex});
+    }
+}
+
+bool FCrystalPathField::StepSolve(const int32 MaxCells) {
+    if (!bSolving) { return true; }
+
+    const float DiagonalSize = CellSize * UE_SQRT_2;
+    int32 CellsExpanded = 0;
+    while (!OpenCells.IsEmpty()) {
+        if (CellsExpanded++ == MaxCells) { return false; }
+
+        FOpenCell Current;
+        OpenCells.HeapPop(Current, EAllowShrinking::No);
+        if (Current.Distance > PendingDistances[Current.CellIndex]) { continue; }
+
+        // A crystal's own cell is usually an expensive nav area, leaving it only costs the way out
+        const bool bSource = PendingSourceCells[Current.CellIndex];
+        const int32 X = Current.CellIndex % GridSize.X;
+        const int32 Y = Current.CellIndex / GridSize.X;
+        for (const int32 (&Offset)[2] : NeighbourOffsets) {
+            const int32 NX = X + Offset[0];
+            const int32 NY = Y + Offset[1];
+            if (NX < 0 || NY < 0 || NX >= GridSize.X || NY >= GridSize.Y) { continue; }
+
+            const int32 Neighbour = NY * GridSize.X + NX;
+            if (IsBlocked(Neighbour)) { continue; }
+
+            // No cutting corners past blocked cells
+            const bool bDiagonal = Offset[0] != 0 && Offset[1] != 0;
+            if (bDiagonal && (IsBlocked(Y * GridSize.X + NX) || IsBlocked(NY * GridSize.X + X))) {
+                continue;
+            }
+
+            const float CurrentCost = bSource
+                                          ? CellCosts[Neighbour]
+                                          : CellCosts[Current.CellIndex];
+            const float StepCost = (bDiagonal ? DiagonalSize : CellSize)
+                                   * 0.5f * (CurrentCost + CellCosts[Neighbour]);
+            const float Distance = Current.Distance + StepCost;
+            if (Distance < PendingDistances[Neighbour]) {
+                PendingDistances[Neighbour] = Distance;
+                PendingNearestSources[Neighbour] = PendingNearestSources[Current.CellIndex];
+                OpenCells.HeapPush({Distance, Neighbour});
+            }
+        }
+    }
+
+    // Publish the result, keeping the old arrays' allocations for the next solve
+    Swap(Distances, PendingDistances);
+    Swap(NearestSources, PendingNearestSources);
+    Swap(SourceHandles, PendingSourceHandles);
+    bSolving = false;
+    return true;
+}
+
+bool FCrystalPathField::Sample(const FVector& Location,
+                               FEntityHandle& OutSource,
+                               float& OutCost) const {
+    if (!IsSolved()) { return false; }
+
+    const int32 CellIndex = GetCellIndex(Location);
+    if (CellIndex == INDEX_NONE) { return false; }
+
+    int32 BestCell = NearestSources[CellIndex] != INDEX_NONE ? CellIndex : INDEX_NONE;
+    float BestCost = BestCell != INDEX_NONE ? Distances[CellIndex] : MAX_flt;
+
+    if (BestCell == INDEX_NONE) {
+        const int32 X = CellIndex % GridSize.X;
+        const int32 Y = CellIndex / GridSize.X;
+        for (const int32 (&Offset)[2] : NeighbourOffsets) {
+            const int32 NX = X + Offset[0];
+            const int32 NY = Y + Offset[1];
+            if (NX < 0 || NY < 0 || NX >= GridSize.X || NY >= GridSize.Y) { continue; }
+
+            const int32 Neighbour = NY * GridSize.X + NX;
+            const float StepSize = Offset[0] != 0 && Offset[1] != 0 ? CellSize * UE_SQRT_2 : CellSize;
+            if (NearestSources[Neighbour] != INDEX_NONE
+                && Distances[Neighbour] + StepSize < BestCost) {
+                BestCell = Neighbour;
+                BestCost = Distances[Neighbour] + StepSize;
+            }
+        }
+    }
+
+    if (BestCell == INDEX_NONE) { return false; }
+
+    OutSource = SourceHandles[NearestSources[BestCell]];
+    OutCost = BestCost;
+    return true;
+}
+
+bool FCrystalPathField::GetFlowDirection(const FVector& Location, FVector& OutDirection) const {
+    if (!IsSolved()) { return false; }
+
+    const int32 CellIndex = GetCellIndex(Location);
+    if (CellIndex == INDEX_NONE) { return false; }
+
+    // Unreached cells, e.g. agents pushed onto a wall, steer to whichever neighbour is reached
+    const bool bReached = NearestSources[CellIndex] != INDEX_NONE;
+    int32 BestCell = INDEX_NONE;
+    float BestDistance = bReached ? Distances[CellIndex] : MAX_flt;
+
+    const int32 X = CellIndex % GridSize.X;
+    const int32 Y = CellIndex / GridSize.X;
+    for (const int32 (&Offset)[2] : NeighbourOffsets) {
+        const int32 NX = X + Offset[0];
+        const int32 NY = Y + Offset[1];
+        if (NX < 0 || NY < 0 || NX >= GridSize.X || NY >= GridSize.Y) { continue; }
+
+        const int32 Neighbour = NY * GridSize.X + NX;
+        if (NearestSources[Neighbour] == INDEX_NONE) { continue; }
+
+        // Same corner rule as the solve, so agents never steer diagonally into a wall
+        const bool bDiagonal = Offset[0] != 0 && Offset[1] != 0;
+        if (bDiagonal && (IsBlocked(Y * GridSize.X + NX) || IsBlocked(NY * GridSize.X + X))) {
+            continue;
+        }
+
+        if (Distances[Neighbour] < BestDistance) {
+            BestCell = Neighbour;
+            BestDistance = Distances[Neighbour];
+        }
+    }
+
+    if (BestCell == INDEX_NONE) {
+        OutDirection = FVector::ZeroVector;
+        return bReached;
+    }
+
+    OutDirection = (GetCellCenter(BestCell) - Location).GetSafeNormal2D();
+    return true;
+}
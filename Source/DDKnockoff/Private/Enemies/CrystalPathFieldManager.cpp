@@ -0,0 +1,396 @@
+#include "Enemies/CrystalPathFieldManager.h"
+
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
+#include "Engine/World.h"
+#include "Entities/Entity.h"
+#include "Entities/EntityManager.h"
+#include "NavigationSystem.h"
+#include "NavAreas/NavArea.h"
+#include "NavMesh/RecastNavMesh.h"
+
+namespace {
+    bool AffectsNavigation(const EEntityType Type) {
+        return Type == EEntityType::Structure_Defense || Type == EEntityType::Structure_Crystal
+               || Type == EEntityType::Interactable;
+    }
+}
+
+void UCrystalPathFieldManager::Initialize() {
+    EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(GetWorld());
+    ensureAlways(EntityManager);
+
+    // Start from an empty field, also when reinitialized by a level reset
+    Field = FCrystalPathField();
+    GoalFields.Reset();
+    PendingGoalFields.Reset();
+    DirtyCells.Reset();
+    DirtyCellFlags.Reset();
+    StructureBounds.Reset();
+    bSolvePending = true;
+
+    if (EntityManager) {
+        // Only structures and interactables carry nav modifiers, filtered in the handler
+        FEntityChangeFilter Filter;
+        Filter.ChangeTypes = EEntityChangeType::Added | EEntityChangeType::Removed
+                             | EEntityChangeType::TargetabilityChanged;
+        EntityChangesHandle = EntityManager->SubscribeToChanges(
+            Filter,
+            FOnEntityChangesDelegate::CreateUObject(this,
+                                                    &UCrystalPathFieldManager::OnEntityChanges));
+    }
+
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+        GetWorld())) {
+        NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(
+            this,
+            &UCrystalPathFieldManager::OnNavigationGenerationFinished);
+    }
+
+    ScheduleRebuild();
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UCrystalPathFieldManager::Deinitialize() {
+    // The rebuild job calls back into this manager, so stop it first
+    if (UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld())) {
+        Handler->CancelJob(RebuildJob);
+    }
+    RebuildJob = FManagerJobHandle();
+
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+        GetWorld())) {
+        NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(
+            this,
+            &UCrystalPathFieldManager::OnNavigationGenerationFinished);
+    }
+
+    if (EntityManager) { EntityManager->UnsubscribeFromChanges(EntityChangesHandle); }
+    EntityChangesHandle.Reset();
+    EntityManager = nullptr;
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+}
+
+void UCrystalPathFieldManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UEntityManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+FEntityHandle UCrystalPathFieldManager::FindNearestCrystal(const FVector& Location,
+                                                           float* OutPathCost) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CrystalPathField_Sample);
+
+    FEntityHandle Crystal;
+    float PathCost = 0.0f;
+    if (!Field.Sample(Location, Crystal, PathCost)) { return FEntityHandle(); }
+
+    // Crystals destroyed since the last solve stay in the field until the re-solve runs
+    if (EntityManager && !EntityManager->ResolveActor(Crystal)) { return FEntityHandle(); }
+
+    if (OutPathCost) { *OutPathCost = PathCost; }
+    return Crystal;
+}
+
+bool UCrystalPathFieldManager::RequestGoalField(const FEntityHandle& Goal) {
+    if (GoalFields.Contains(Goal)) { return true; }
+    if (!IsFieldReady() || !EntityManager) { return false; }
+
+    const IEntity* GoalEntity = Cast<IEntity>(EntityManager->ResolveActor(Goal));
+    if (!GoalEntity || GoalEntity->GetEntityType() != EEntityType::Structure_Crystal) {
+        return false;
+    }
+
+    GoalFields.Add(Goal);
+    PendingGoalFields.Add(Goal);
+    ScheduleRebuild();
+    return true;
+}
+
+const FCrystalPathField* UCrystalPathFieldManager::GetGoalField(const FEntityHandle& Goal) const {
+    const FCrystalPathField* GoalField = GoalFields.Find(Goal);
+    return GoalField && GoalField->IsSolved() ? GoalField : nullptr;
+}
+
+void UCrystalPathFieldManager::MarkAreaDirty(const FBox& Bounds) {
+    if (!Bounds.IsValid) { return; }
+
+    bSolvePending = true;
+
+    // Cells are dirtied once the grid exists, until then the whole grid is sampled anyway
+    if (Field.IsInitialized()) {
+        const float Size = Field.GetCellSize();
+        for (double Y = Bounds.Min.Y; Y < Bounds.Max.Y + Size; Y += Size) {
+            for (double X = Bounds.Min.X; X < Bounds.Max.X + Size; X += Size) {
+                const int32 CellIndex = Field.GetCellIndex(
+                    FVector(FMath::Min(X, Bounds.Max.X), FMath::Min(Y, Bounds.Max.Y), 0.0));
+                if (CellIndex == INDEX_NONE || DirtyCellFlags[CellIndex]) { continue; }
+
+                DirtyCellFlags[CellIndex] = true;
+                DirtyCells.Add(CellIndex);
+            }
+        }
+    }
+
+    ScheduleRebuild();
+}
+
+void UCrystalPathFieldManager::MarkSourcesDirty() {
+    bSolvePending = true;
+    ScheduleRebuild();
+}
+
+bool UCrystalPathFieldManager::IsRebuildPending() const {
+    const UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld());
+    return Handler && Handler->IsJobPending(RebuildJob);
+}
+
+void UCrystalPathFieldManager::ResetGridForTesting(const FBox& Bounds) {
+    Field.Reset(Bounds, CellSize);
+    DirtyCells.Reset();
+    DirtyCellFlags.Init(false, Field.Num());
+    bSolvePending = true;
+    ScheduleRebuild();
+}
+
+void UCrystalPathFieldManager::ScheduleRebuild() {
+    // The rebuild may wait on the navmesh for several frames, so it is never run inline
+    UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld());
+    if (!Handler || Handler->IsJobPending(RebuildJob)) { return; }
+
+    RebuildJob = Handler->SubmitJob(TEXT("CrystalPathField"),
+                                    RebuildBudgetMs,
+                                    [this] { return RebuildStep(); },
+                                    this);
+}
+
+EManagerJobStatus UCrystalPathFieldManager::RebuildStep() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CrystalPathField_Rebuild);
+
+    // Finish the solve in flight before touching cell costs, it is published in one go
+    if (Field.IsSolving() && !StepSolveField()) { return EManagerJobStatus::Continue; }
+
+    // Goal fields are solved from the costs the main field was just solved with
+    if (!PendingGoalFields.IsEmpty()) {
+        StepGoalField();
+        return EManagerJobStatus::Continue;
+    }
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+
+    // Without a navmesh every cell is walkable, OnNavigationGenerationFinished resamples later
+    if (!NavSys || !NavData) {
+        if (!Field.IsInitialized()) { return EManagerJobStatus::Complete; }
+        DirtyCells.Reset();
+        DirtyCellFlags.Init(false, Field.Num());
+    } else {
+        // Nav modifier changes only show up once the affected tiles have been rebuilt, and
+        // modifiers registered this frame are still queued as dirty areas until the next build
+        if (NavSys->IsNavigationBuildInProgress() || NavSys->HasDirtyAreasQueued()) {
+            return EManagerJobStatus::Continue;
+        }
+
+        if (!Field.IsInitialized()) { ResetGrid(*NavData); }
+
+        int32 CellsSampled = 0;
+        while (!DirtyCells.IsEmpty()) {
+            if (CellsSampled++ == CellsPerRebuildStep) { return EManagerJobStatus::Continue; }
+
+            const int32 CellIndex = DirtyCells.Pop(EAllowShrinking::No);
+            DirtyCellFlags[CellIndex] = false;
+            SampleCell(*NavSys, *NavData, CellIndex);
+            ++LastResampledCells;
+        }
+    }
+
+    // The solve is stepped by the following slices
+    if (bSolvePending) {
+        BeginSolveField();
+        return EManagerJobStatus::Continue;
+    }
+    return EManagerJobStatus::Complete;
+}
+
+void UCrystalPathFieldManager::ResetGrid(const ANavigationData& NavData) {
+    const FBox Bounds = NavData.GetBounds();
+    if (!Bounds.IsValid) { return; }
+
+    const float LongestSide = FMath::Max(Bounds.GetSize().X, Bounds.GetSize().Y);
+    Field.Reset(Bounds, FMath::Max(CellSize, LongestSide / MaxCellsPerSide));
+
+    DirtyCells.Reset(Field.Num());
+    for (int32 CellIndex = Field.Num() - 1; CellIndex >= 0; --CellIndex) {
+        DirtyCells.Add(CellIndex);
+    }
+    DirtyCellFlags.Init(true, Field.Num());
+    bSolvePending = true;
+    LastResampledCells = 0;
+}
+
+void UCrystalPathFieldManager::SampleCell(const UNavigationSystemV1& NavSys,
+                                          const ANavigationData& NavData,
+                                          const int32 CellIndex) {
+    // Project from the cell center with the whole navmesh height, so any floor in the column counts
+    const float HalfCell = Field.GetCellSize() * 0.5f;
+    const FVector Extent(HalfCell, HalfCell, FMath::Max(NavData.GetBounds().GetExtent().Z, 1.0));
+
+    FNavLocation NavLocation;
+    if (!NavSys.ProjectPointToNavigation(Field.GetCellCenter(CellIndex),
+                                         NavLocation,
+                                         Extent,
+                                         &NavData)) {
+        Field.SetCellCost(CellIndex, FCrystalPathField::BlockedCost);
+        return;
+    }
+
+    // Weight the cell by its area's travel cost, which is how structures steer paths around them
+    float Cost = 1.0f;
+    if (const ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(&NavData)) {
+        const uint32 AreaID = NavMesh->GetPolyAreaID(NavLocation.NodeRef);
+        if (const UClass* AreaClass = NavMesh->GetAreaClass(AreaID)) {
+            Cost = GetDefault<UNavArea>(AreaClass)->DefaultCost;
+        }
+    }
+    Field.SetCellCost(CellIndex, Cost);
+}
+
+void UCrystalPathFieldManager::BeginSolveField() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CrystalPathField_Solve);
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FCrystalPathField::FSource> Sources;
+    if (EntityManager) {
+        const FEntityView Crystals = EntityManager->ViewEntitiesByType(
+            EEntityType::Structure_Crystal);
+        Sources.Reserve(Crystals.Num());
+        for (int32 i = 0; i < Crystals.Num(); ++i) {
+            const TScriptInterface<IEntity>& Crystal = Crystals[i];
+            if (!Crystal.GetObject() || !IsValid(Crystal.GetObject())) { continue; }
+
+            const AActor* CrystalActor = Crystal->GetActor();
+            if (!CrystalActor) { continue; }
+
+            Sources.Add({CrystalActor->GetActorLocation(), Crystal->GetEntityHandle()});
+        }
+    }
+
+    Field.BeginSolve(Sources);
+    bSolvePending = false;
+    CurrentSolveMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+bool UCrystalPathFieldManager::StepSolveField() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CrystalPathField_Solve);
+
+    const double StartTime = FPlatformTime::Seconds();
+    const bool bSolved = Field.StepSolve(CellsPerSolveStep);
+    CurrentSolveMs += static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    if (!bSolved) { return false; }
+
+    // Every goal field follows the main field's costs, they answer from their last solve until
+    // their turn comes
+    for (const TPair<FEntityHandle, FCrystalPathField>& GoalField : GoalFields) {
+        PendingGoalFields.AddUnique(GoalField.Key);
+    }
+
+    ++NumSolves;
+    LastSolveMs = CurrentSolveMs;
+    return true;
+}
+
+void UCrystalPathFieldManager::StepGoalField() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_CrystalPathField_Solve);
+
+    const FEntityHandle Goal = PendingGoalFields[0];
+    FCrystalPathField* GoalField = GoalFields.Find(Goal);
+    if (!GoalField) {
+        PendingGoalFields.RemoveAt(0, 1, EAllowShrinking::No);
+        return;
+    }
+
+    if (!GoalField->IsSolving()) {
+        const AActor* GoalActor = EntityManager ? EntityManager->ResolveActor(Goal) : nullptr;
+        if (!GoalActor) {
+            // Agents heading for a destroyed crystal fall back to the main field
+            GoalFields.Remove(Goal);
+            PendingGoalFields.RemoveAt(0, 1, EAllowShrinking::No);
+            return;
+        }
+
+        GoalField->CopyCosts(Field);
+        GoalField->BeginSolve({{GoalActor->GetActorLocation(), Goal}});
+    }
+
+    if (GoalField->StepSolve(CellsPerSolveStep)) {
+        PendingGoalFields.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+}
+
+void UCrystalPathFieldManager::OnEntityChanges(const TConstArrayView<FEntityChangeRecord> Changes) {
+    for (const FEntityChangeRecord& Change : Changes) {
+        if (!AffectsNavigation(Change.Type)) { continue; }
+
+        if (Change.Type == EEntityType::Structure_Crystal) { bSolvePending = true; }
+
+        if (Change.ChangeType == EEntityChangeType::Removed) {
+            FBox Bounds;
+            if (StructureBounds.RemoveAndCopyValue(Change.Handle, Bounds)) { MarkAreaDirty(Bounds); }
+            continue;
+        }
+
+        // Placement toggles targetability, by then the structure's nav modifier is in place
+        const AActor* Actor = EntityManager ? EntityManager->ResolveActor(Change.Handle) : nullptr;
+        if (!Actor) { continue; }
+
+        const FBox Bounds = Actor->GetComponentsBoundingBox(true);
+        StructureBounds.Add(Change.Handle, Bounds);
+        MarkAreaDirty(Bounds);
+    }
+
+    if (bSolvePending) { ScheduleRebuild(); }
+}
+
+void UCrystalPathFieldManager::OnNavigationGenerationFinished(ANavigationData* NavData) {
+    // The first build sizes the grid, later ones are picked up through the dirtied areas
+    if (!Field.IsInitialized()) { bSolvePending = true; }
+    if (bSolvePending || !DirtyCells.IsEmpty()) { ScheduleRebuild(); }
+}
+
+SIZE_T UCrystalPathFieldManager::GetAllocatedSize() const {
+    SIZE_T Size = Field.GetAllocatedSize() + GoalFields.GetAllocatedSize()
+                  + PendingGoalFields.GetAllocatedSize() + DirtyCells.GetAllocatedSize() + DirtyCellFlags.GetAllocatedSize()
+                  + StructureBounds.GetAllocatedSize();
+    for (const TPair<FEntityHandle, FCrystalPathField>& GoalField : GoalFields) {
+        Size += GoalField.Value.GetAllocatedSize();
+    }
+    return Size;
+}
+
+FString UCrystalPathFieldManager::GetDebugCategory() const { return TEXT("Crystal Path Field"); }
+
+FString UCrystalPathFieldManager::GetDebugInformation() const {
+    const FIntPoint GridSize = Field.GetGridSize();
+    return FString::Printf(
+        TEXT("Grid: %dx%d @ %.0fuu\nReady: %s\nDirty Cells: %d\nResampled Cells: %d\n"
+            "Goal Fields: %d\nSolves: %d\nLast Solve: %.3fms"),
+        GridSize.X,
+        GridSize.Y,
+        Field.GetCellSize(),
+        IsFieldReady() ? TEXT("Yes") : TEXT("No"),
+        DirtyCells.Num(),
+        LastResampledCells,
+        GoalFields.Num(),
+        NumSolves,
+        LastSolveMs);
+}
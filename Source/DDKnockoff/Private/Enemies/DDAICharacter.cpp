@@ -1,6 +1,7 @@
 ﻿#include "Enemies/DDAICharacter.h"
 
 #include "Enemies/AIAnimInstance.h"
+#include "Enemies/AISignificanceManager.h"
 #include "Enemies/DDAIController.h"
 #include "Components/BoxComponent.h"
 #include "Engine/LocalPlayer.h"
@@ -15,7 +16,6 @@
 #include "Entities/EntityManager.h"
 #include "Health/HealthComponent.h"
 #include "Utils/CollisionUtils.h"
-#include "Utils/GeometryUtils.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
 
@@ -150,42 +150,126 @@ CharacterActorOverlapState ADDAICharacter::GetActorOverlapState() const {
     return ActorOverlapState;
 }
 
-TWeakObjectPtr<AActor> ADDAICharacter::GetClosestOverlappingStructure() const {
+FEntityHandle ADDAICharacter::GetClosestOverlappingStructure() const {
     return ClosestOverlappingStructure;
 }
 
 void ADDAICharacter::Tick(const float DeltaSeconds) {
     Super::Tick(DeltaSeconds);
-    TargetDetectionCollider->GetOverlappingActors(ActorsInDetectionRange);
-
-    // If we are overlapping any defensive structures, we need to set the overlap state
-    AActor* ClosestOverlappingRelevantActor = nullptr;
-    float ClosestDistance = MAX_FLT;
-
-    for (const auto Actor : ActorsInDetectionRange) {
-        if (const auto Entity = Cast<IEntity>(Actor)) {
-            if ((Entity->GetEntityType() == EEntityType::Structure_Defense
-                 || Entity->GetEntityType() == EEntityType::Structure_Crystal)
-                && Entity->IsCurrentlyTargetable()) {
-                // Calculate distance to this actor
-                const float Distance = UGeometryUtils::GetDistanceBetweenActors(this, Actor);
-                if (Distance < ClosestDistance) {
-                    ClosestDistance = Distance;
-                    ClosestOverlappingRelevantActor = Actor;
-                }
-            }
+
+    // Overlap events keep the candidates current, so most frames there is nothing to score
+    if (NeedsOverlapRescore()) { ScoreOverlapCandidates(); }
+}
+
+void ADDAICharacter::OnTargetDetectionBeginOverlap(UPrimitiveComponent* OverlappedComponent,
+                                                   AActor* OtherActor,
+                                                   UPrimitiveComponent* OtherComp,
+                                                   int32 OtherBodyIndex,
+                                                   bool bFromSweep,
+                                                   const FHitResult& SweepResult) {
+    AddOverlapCandidate(OtherActor);
+}
+
+void ADDAICharacter::OnTargetDetectionEndOverlap(UPrimitiveComponent* OverlappedComponent,
+                                                 AActor* OtherActor,
+                                                 UPrimitiveComponent* OtherComp,
+                                                 int32 OtherBodyIndex) {
+    // Actors with several hurtboxes end one overlap per component, keep them until the last
+    if (!OtherActor || TargetDetectionCollider->IsOverlappingActor(OtherActor)) { return; }
+
+    if (OverlapCandidates.Remove(OtherActor) > 0) { bOverlapCandidatesDirty = true; }
+}
+
+void ADDAICharacter::AddOverlapCandidate(AActor* Actor) {
+    const IEntity* Entity = Cast<IEntity>(Actor);
+    if (!Entity) { return; }
+
+    const EEntityType Type = Entity->GetEntityType();
+    if (Type != EEntityType::Structure_Defense && Type != EEntityType::Structure_Crystal) {
+        return;
+    }
+
+    if (OverlapCandidates.Contains(Actor)) { return; }
+
+    OverlapCandidates.Add(Actor);
+    bOverlapCandidatesDirty = true;
+}
+
+bool ADDAICharacter::NeedsOverlapRescore() const {
+    if (bOverlapCandidatesDirty || bHasPendingOverlapCandidates) { return true; }
+    if (OverlapCandidates.IsEmpty()) { return false; }
+
+    // The structure being targeted was destroyed, disabled or unregistered
+    if (ActorOverlapState == CharacterActorOverlapState::OverlappingStructure) {
+        const int32 HotIndex = EntityManager->GetHotIndex(ClosestOverlappingStructure);
+        if (HotIndex == INDEX_NONE || !EntityManager->GetHotData().Targetable[HotIndex]) {
+            return true;
         }
     }
 
-    if (ClosestOverlappingRelevantActor == nullptr) {
+    // Structures stay put, so the closest one only changes as we walk past several of them
+    return OverlapCandidates.Num() > 1
+           && FVector::DistSquared(GetActorLocation(), LastOverlapScoreLocation)
+           > FMath::Square(OverlapRescoreDistance);
+}
+
+void ADDAICharacter::ScoreOverlapCandidates() {
+    bOverlapCandidatesDirty = false;
+    bHasPendingOverlapCandidates = false;
+
+    // Type, targetability and position come from the entity manager's hot data
+    const FEntityHotData& HotData = EntityManager->GetHotData();
+    const FVector Location = GetActorLocation();
+    LastOverlapScoreLocation = Location;
+    int32 ClosestHotIndex = INDEX_NONE;
+    float ClosestDistanceSquared = MAX_FLT;
+
+    for (int32 CandidateIndex = OverlapCandidates.Num() - 1; CandidateIndex >= 0;
+         --CandidateIndex) {
+        const IEntity* Entity = Cast<IEntity>(OverlapCandidates[CandidateIndex].Get());
+        if (!Entity) {
+            OverlapCandidates.RemoveAtSwap(CandidateIndex, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        // Structures that are not registered or targetable yet are checked again next tick
+        const int32 HotIndex = EntityManager->GetHotIndex(Entity->GetEntityHandle());
+        if (HotIndex == INDEX_NONE || !HotData.Targetable[HotIndex]) {
+            bHasPendingOverlapCandidates = true;
+            continue;
+        }
+
+        const EEntityType Type = HotData.Types[HotIndex];
+        if (Type != EEntityType::Structure_Defense && Type != EEntityType::Structure_Crystal) {
+            continue;
+        }
+
+        const float DistanceSquared = FVector::DistSquared(HotData.Positions[HotIndex], Location);
+        if (DistanceSquared < ClosestDistanceSquared) {
+            ClosestDistanceSquared = DistanceSquared;
+            ClosestHotIndex = HotIndex;
+        }
+    }
+
+    if (ClosestHotIndex == INDEX_NONE) {
         // If we are not overlapping any relevant actors, set the overlap state to none
         ActorOverlapState = CharacterActorOverlapState::None;
     } else {
         ActorOverlapState = CharacterActorOverlapState::OverlappingStructure;
-        ClosestOverlappingStructure = ClosestOverlappingRelevantActor;
+        ClosestOverlappingStructure = HotData.Handles[ClosestHotIndex];
     }
 }
 
+void ADDAICharacter::SetSignificanceTier(const EAISignificanceTier Tier) {
+    SignificanceTier = Tier;
+
+    // The actor tick only re-scores the overlapped structures, so its interval is the poll rate
+    const FAISignificanceTierSettings& Settings = UAISignificanceManager::GetTierSettings(Tier);
+    SetActorTickInterval(Settings.OverlapPollInterval);
+    GetMesh()->SetComponentTickInterval(Settings.AnimationTickInterval);
+    GetCharacterMovement()->SetComponentTickInterval(Settings.MovementTickInterval);
+}
+
 EEnemyPoseState ADDAICharacter::GetCurrentPoseState() const {
     return AnimInstance->GetCurrentPoseState();
 }
@@ -229,8 +313,8 @@ void ADDAICharacter::BeginPlay() {
     // Validate configuration
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     // Initialize animation instance
     AnimInstance = Cast<UAIAnimInstance>(GetMesh()->GetAnimInstance());
@@ -241,11 +325,28 @@ void ADDAICharacter::BeginPlay() {
     HealthComponent->OnReachedZeroHealth.AddDynamic(this, &ADDAICharacter::OnDeath);
     HitboxComponent->OnComponentBeginOverlap.RemoveDynamic(this, &ADDAICharacter::OnHitboxOverlap);
     HitboxComponent->OnComponentBeginOverlap.AddDynamic(this, &ADDAICharacter::OnHitboxOverlap);
+    TargetDetectionCollider->OnComponentBeginOverlap.RemoveDynamic(
+        this,
+        &ADDAICharacter::OnTargetDetectionBeginOverlap);
+    TargetDetectionCollider->OnComponentBeginOverlap.AddDynamic(
+        this,
+        &ADDAICharacter::OnTargetDetectionBeginOverlap);
+    TargetDetectionCollider->OnComponentEndOverlap.RemoveDynamic(
+        this,
+        &ADDAICharacter::OnTargetDetectionEndOverlap);
+    TargetDetectionCollider->OnComponentEndOverlap.AddDynamic(
+        this,
+        &ADDAICharacter::OnTargetDetectionEndOverlap);
+
+    // Overlaps from the spawn location began before the events were bound
+    TArray<AActor*> OverlappingActors;
+    TargetDetectionCollider->GetOverlappingActors(OverlappingActors);
+    for (AActor* Actor : OverlappingActors) { AddOverlapCandidate(Actor); }
 }
 
 void ADDAICharacter::EndPlay(const EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
     Super::EndPlay(EndPlayReason);
 }
 
@@ -1,11 +1,12 @@
 ﻿#include "Enemies/DDAIController.h"
 
+#include "Enemies/AIDirectorManager.h"
 #include "Enemies/DDAICharacter.h"
 #include "Enemies/EnemyCharacterEnums.h"
-#include "NavigationSystem.h"
+#include "Enemies/FlowFieldMovementManager.h"
+#include "Enemies/PathRequestManager.h"
+#include "Entities/Entity.h"
 #include "Core/ManagerHandlerSubsystem.h"
-#include "Crystal/CrystalStructure.h"
-#include "Entities/EntityManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Navigation/CrowdFollowingComponent.h"
 #include "Navigation/PathFollowingComponent.h"
@@ -13,8 +14,10 @@
 ADDAIController::ADDAIController(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer.SetDefaultSubobjectClass(
           TEXT("PathFollowingComponent"),
-          UCrowdFollowingComponent::StaticClass())), AICharacter(nullptr), CurrentAIState() {
-    PrimaryActorTick.bCanEverTick = true;
+          UCrowdFollowingComponent::StaticClass())), AICharacter(nullptr), AIDirector(nullptr),
+      PathRequests(nullptr), FlowFieldMovement(nullptr) {
+    // Decisions are made by the AI director in one batched pass
+    PrimaryActorTick.bCanEverTick = false;
 
     if (const auto CrowdFollowingComponent = Cast<
         UCrowdFollowingComponent>(GetPathFollowingComponent())) {
@@ -26,101 +29,25 @@ void ADDAIController::BeginPlay() {
     Super::BeginPlay();
     
     ValidateConfiguration();
-
-    CurrentAIState = EEnemyAIState::None;
-    LastTargetUpdateTime = 0.0f;
 }
 
-void ADDAIController::Tick(const float DeltaTime) {
-    Super::Tick(DeltaTime);
-
-    if (!CanMakeDecisions()) { return; }
+void ADDAIController::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+    if (AIDirector) { AIDirector->UnregisterAgent(this); }
+    AIDirector = nullptr;
+    if (PathRequests) { PathRequests->CancelRequest(this); }
+    PathRequests = nullptr;
+    if (FlowFieldMovement) { FlowFieldMovement->RemoveAgent(AICharacter); }
+    FlowFieldMovement = nullptr;
 
-    if (ShouldUpdateTargeting()) {
-        UpdateTarget();
-        LastTargetUpdateTime = GetWorld()->GetTimeSeconds();
-    }
-
-    // TODO - instead of returning, have a loop that runs until the state machine doesn't have anything left to process.
-    // Allow external factors to re-run the state machine as necessary.
-    ProcessCurrentState();
+    Super::EndPlay(EndPlayReason);
 }
 
 void ADDAIController::OnCharacterTookKnockback() {
     StopMovement();
+    if (PathRequests) { PathRequests->CancelRequest(this); }
+    if (FlowFieldMovement) { FlowFieldMovement->RemoveAgent(AICharacter); }
     // TODO - should prompt a target update after a delay?
-    TargetStructure.Reset();
-}
-
-void ADDAIController::ProcessCurrentState() {
-    switch (CurrentAIState) {
-        case EEnemyAIState::None:
-            HandleIdleState();
-            break;
-        case EEnemyAIState::MovingTowardsTarget:
-            HandleMovingState();
-            break;
-        case EEnemyAIState::AttackingTarget:
-            HandleAttackingState();
-            break;
-        default: ;
-    }
-}
-
-void ADDAIController::HandleIdleState() { TransitionToState(EEnemyAIState::MovingTowardsTarget); }
-
-void ADDAIController::HandleMovingState() {
-    // First check if we need a new target
-    if (!TargetIsValid()) {
-        StopPathingAndMovement();
-        UpdateTarget();
-        MoveToTarget();
-        return;
-    }
-
-    // If we're overlapping a defense, prioritize attacking it
-    if (CharacterIsOverlappingADefense()) {
-        // Update our current target to the closest overlapping structure
-        if (AICharacter->GetClosestOverlappingStructure() != TargetStructure) { UpdateTarget(); }
-
-        StopPathingAndMovement();
-        TransitionToState(EEnemyAIState::AttackingTarget);
-        return;
-    }
-
-    if (CheckIfPathComponentIsIdle()) { MoveToTarget(); }
-}
-
-void ADDAIController::HandleAttackingState() {
-    // If we lost our target or it's being destroyed, find a new one
-    if (!TargetIsValid()) {
-        TransitionToState(EEnemyAIState::MovingTowardsTarget);
-        return;
-    }
-
-    // If we're overlapping a defense, prioritize attacking it
-    if (CharacterIsOverlappingADefense()) {
-        // Update our current target to the closest overlapping structure
-        if (AICharacter->GetClosestOverlappingStructure() != TargetStructure) { UpdateTarget(); }
-
-        AttackIfAble(*TargetStructure.Get());
-        return;
-    }
-
-    TransitionToState(EEnemyAIState::MovingTowardsTarget);
-}
-
-bool ADDAIController::CharacterIsOverlappingADefense() const {
-    if (!AICharacter) { return false; }
-
-    return AICharacter->GetActorOverlapState() == CharacterActorOverlapState::OverlappingStructure;
-}
-
-void ADDAIController::TransitionToState(const EEnemyAIState NewState) {
-    if (CurrentAIState == NewState) { return; }
-
-    // TODO - maybe want to do the movement stopping when we enter states via a state machine instead of every frame.
-    CurrentAIState = NewState;
+    if (AIDirector) { AIDirector->ClearTarget(this); }
 }
 
 bool ADDAIController::CanMakeDecisions() const {
@@ -129,78 +56,60 @@ bool ADDAIController::CanMakeDecisions() const {
     return AICharacter->GetCurrentPoseState() == EEnemyPoseState::Locomotion;
 }
 
-bool ADDAIController::ShouldUpdateTargeting() const {
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
-    return CurrentTime - LastTargetUpdateTime >= TargetUpdateInterval;
-}
-
 void ADDAIController::AttackIfAble(AActor& Target) const {
     if (AICharacter) { AICharacter->AttackIfAble(Target); }
 }
 
 void ADDAIController::StopPathingAndMovement() {
+    if (PathRequests) { PathRequests->CancelRequest(this); }
+    if (FlowFieldMovement) { FlowFieldMovement->RemoveAgent(AICharacter); }
+
     if (GetPathFollowingComponent()->GetStatus() == EPathFollowingStatus::Moving) {
         StopMovement();
         if (AICharacter) { AICharacter->GetCharacterMovement()->StopActiveMovement(); }
     }
 }
 
-void ADDAIController::MoveToTarget() {
-    if (!TargetIsValid()) { return; }
+void ADDAIController::MoveToTarget(AActor& Target) {
+    // Crystals have a shared flow field, anything else is pathed to individually
+    if (FlowFieldMovement) {
+        const IEntity* TargetEntity = Cast<IEntity>(&Target);
+        if (TargetEntity
+            && FlowFieldMovement->SetAgentGoal(AICharacter, TargetEntity->GetEntityHandle())) {
+            StopMovement();
+            return;
+        }
+    }
+
+    // Queue the path so identical requests share a query and bursts are spread over frames
+    if (PathRequests && AICharacter) {
+        PathRequests->RequestPath(this,
+                                  AICharacter->GetNavAgentLocation(),
+                                  Target,
+                                  AICharacter->GetNavAgentPropertiesRef());
+        return;
+    }
 
     FAIMoveRequest MoveRequest;
-    MoveRequest.SetGoalActor(Cast<IEntity>(TargetStructure.Get())->GetActor());
+    MoveRequest.SetGoalActor(&Target);
     MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
 
     FNavPathSharedPtr NavPath;
     MoveTo(MoveRequest, &NavPath);
 }
 
-// TODO - This is extremely computationally expensive and should be replaced when we overhaul the AI system.
-void ADDAIController::UpdateTarget() {
-    if (CharacterIsOverlappingADefense()) {
-        TargetStructure = AICharacter->GetClosestOverlappingStructure();
-        return;
-    }
-
-    // TODO - should cache the entity manager instead of getting it every time.
-    const UEntityManager* EntityManager = UManagerHandlerSubsystem::GetManager<
-        UEntityManager>(GetWorld());
-    auto Crystals = EntityManager->GetEntitiesByType(EEntityType::Structure_Crystal);
-
-    ACrystalStructure* NearestCrystal = nullptr;
-    float SmallestPathCost = FLT_MAX;
-
-    for (int i = 0; i < Crystals.Num(); ++i) {
-        const auto CrystalEntity = Crystals[i];
-        if (!CrystalEntity.GetObject() || !IsValid(CrystalEntity.GetObject())) { continue; }
-
-        ACrystalStructure* Crystal = Cast<ACrystalStructure>(CrystalEntity->GetActor());
-
-        Chaos::FReal PathCost = 0.0f;
-        const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
-            GetWorld());
-
-        NavSys->GetPathCost(
-            GetPawn()->GetActorLocation(),
-            Crystal->GetActorLocation(),
-            PathCost);
-
-        if (PathCost < SmallestPathCost) {
-            SmallestPathCost = PathCost;
-            NearestCrystal = Crystal;
-        }
-    }
+void ADDAIController::FollowPath(const FNavPathSharedPtr& Path, AActor& Target) {
+    FAIMoveRequest MoveRequest;
+    MoveRequest.SetGoalActor(&Target);
+    MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
 
-    TargetStructure = NearestCrystal;
+    RequestMove(MoveRequest, Path);
 }
 
-bool ADDAIController::TargetIsValid() const {
-    return TargetStructure.IsValid() && TargetStructure->GetClass()->ImplementsInterface(
-               UEntity::StaticClass());
-}
+bool ADDAIController::IsPathComponentIdle() const {
+    if (PathRequests && PathRequests->IsRequestPending(this)) { return false; }
+    if (FlowFieldMovement && FlowFieldMovement->IsAgentFollowing(AICharacter)) { return false; }
 
-bool ADDAIController::CheckIfPathComponentIsIdle() const {
     return GetPathFollowingComponent()->GetStatus() == EPathFollowingStatus::Idle;
 }
 
@@ -213,6 +122,43 @@ void ADDAIController::OnPossess(APawn* InPawn) {
     AICharacter->Evt_OnTookKnockback.
                  RemoveDynamic(this, &ADDAIController::OnCharacterTookKnockback);
     AICharacter->Evt_OnTookKnockback.AddDynamic(this, &ADDAIController::OnCharacterTookKnockback);
+
+    // Flow-field enemies steer themselves apart, so leave them out of the crowd simulation
+    if (AICharacter->GetMovementMode() == EEnemyMovementMode::FlowField) {
+        FlowFieldMovement = UManagerHandlerSubsystem::GetManager<UFlowFieldMovementManager>(
+            GetWorld());
+        UCrowdFollowingComponent* CrowdFollowingComponent = Cast<UCrowdFollowingComponent>(
+            GetPathFollowingComponent());
+        if (FlowFieldMovement && CrowdFollowingComponent) {
+            CrowdFollowingComponent->SetCrowdSimulationState(ECrowdSimulationState::Disabled);
+        }
+    }
+
+    PathRequests = UManagerHandlerSubsystem::GetManager<UPathRequestManager>(GetWorld());
+
+    AIDirector = UManagerHandlerSubsystem::GetManager<UAIDirectorManager>(GetWorld());
+    if (AIDirector) { AIDirector->RegisterAgent(this); } else {
+        UE_LOG(LogTemp,
+               Warning,
+               TEXT("%s has no AI director to take decisions from"),
+               *GetName());
+    }
+}
+
+void ADDAIController::OnUnPossess() {
+    if (AIDirector) { AIDirector->UnregisterAgent(this); }
+    if (PathRequests) { PathRequests->CancelRequest(this); }
+    PathRequests = nullptr;
+    if (FlowFieldMovement) { FlowFieldMovement->RemoveAgent(AICharacter); }
+    FlowFieldMovement = nullptr;
+
+    if (AICharacter) {
+        AICharacter->Evt_OnTookKnockback.RemoveDynamic(this,
+                                                       &ADDAIController::OnCharacterTookKnockback);
+    }
+    AICharacter = nullptr;
+
+    Super::OnUnPossess();
 }
 
 // IConfigurationValidatable interface implementation
@@ -0,0 +1,210 @@
+#include "Enemies/EngagementManager.h"
+
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
+#include "Enemies/AIDirectorManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/DDAIController.h"
+#include "Entities/EntityManager.h"
+
+void UEngagementManager::Initialize() {
+    EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(GetWorld());
+
+    // Structures are re-registered after a level reset, start with nobody engaged
+    Engagements.Reset();
+    ControllerEngagements.Reset();
+    TotalPromotions = 0;
+
+    if (EntityManager) {
+        FEntityChangeFilter Filter;
+        Filter.ChangeTypes = EEntityChangeType::Removed | EEntityChangeType::TargetabilityChanged;
+        Filter.Faction = EFaction::Player;
+        EntityChangesHandle = EntityManager->SubscribeToChanges(
+            Filter,
+            FOnEntityChangesDelegate::CreateUObject(this, &UEngagementManager::OnEntityChanges));
+    }
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UEngagementManager::Deinitialize() {
+    if (EntityManager) { EntityManager->UnsubscribeFromChanges(EntityChangesHandle); }
+    EntityChangesHandle.Reset();
+    EntityManager = nullptr;
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+
+    Engagements.Empty();
+    ControllerEngagements.Empty();
+}
+
+void UEngagementManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UEntityManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+void UEngagementManager::Tick(const float DeltaTime) {
+    for (auto It = Engagements.CreateIterator(); It; ++It) {
+        FillSlots(It.Value());
+        if (It.Value().SlotHolders.IsEmpty()) { It.RemoveCurrent(); }
+    }
+}
+
+bool UEngagementManager::RequestSlot(ADDAIController* Controller, const FEntityHandle& Structure) {
+    if (!Controller || !Structure.IsValid()) { return false; }
+
+    if (const FEntityHandle* Engaged = ControllerEngagements.Find(Controller)) {
+        if (*Engaged == Structure) { return HasSlot(Controller); }
+        ReleaseSlot(Controller);
+    }
+
+    FStructureEngagement& Engagement = Engagements.FindOrAdd(Structure);
+    ControllerEngagements.Add(Controller, Structure);
+
+    // Nobody jumps the queue, a free slot goes to whoever has waited longest
+    if (Engagement.Queue.IsEmpty() && Engagement.SlotHolders.Num() < SlotsPerStructure) {
+        Engagement.SlotHolders.Add(Controller);
+        return true;
+    }
+
+    Engagement.Queue.Add(Controller);
+    return false;
+}
+
+void UEngagementManager::ReleaseSlot(const ADDAIController* Controller) {
+    FEntityHandle Structure;
+    if (!ControllerEngagements.RemoveAndCopyValue(Controller, Structure)) { return; }
+
+    FStructureEngagement* Engagement = Engagements.Find(Structure);
+    if (!Engagement) { return; }
+
+    const TObjectKey<ADDAIController> Key(Controller);
+    if (Engagement->SlotHolders.RemoveSingleSwap(Key, EAllowShrinking::No) > 0) {
+        FillSlots(*Engagement);
+    } else { Engagement->Queue.RemoveSingle(Key); }
+
+    if (Engagement->SlotHolders.IsEmpty()) { Engagements.Remove(Structure); }
+}
+
+bool UEngagementManager::HasSlot(const ADDAIController* Controller) const {
+    const FEntityHandle* Structure = ControllerEngagements.Find(Controller);
+    const FStructureEngagement* Engagement = Structure ? Engagements.Find(*Structure) : nullptr;
+    return Engagement
+           && Engagement->SlotHolders.Contains(TObjectKey<ADDAIController>(Controller));
+}
+
+bool UEngagementManager::IsWaitingForSlot(const ADDAIController* Controller) const {
+    return ControllerEngagements.Contains(Controller) && !HasSlot(Controller);
+}
+
+int32 UEngagementManager::GetNumSlotHolders(const FEntityHandle& Structure) const {
+    const FStructureEngagement* Engagement = Engagements.Find(Structure);
+    return Engagement ? Engagement->SlotHolders.Num() : 0;
+}
+
+int32 UEngagementManager::GetQueueLength(const FEntityHandle& Structure) const {
+    const FStructureEngagement* Engagement = Engagements.Find(Structure);
+    return Engagement ? Engagement->Queue.Num() : 0;
+}
+
+void UEngagementManager::SetSlotsPerStructure(const int32 InSlotsPerStructure) {
+    SlotsPerStructure = FMath::Max(1, InSlotsPerStructure);
+    for (TPair<FEntityHandle, FStructureEngagement>& Engagement : Engagements) {
+        FillSlots(Engagement.Value);
+    }
+}
+
+void UEngagementManager::OnEntityChanges(const TConstArrayView<FEntityChangeRecord> Changes) {
+    for (const FEntityChangeRecord& Change : Changes) {
+        // Enemies of a dropped engagement find their target invalid and move on
+        if (Change.ChangeType == EEntityChangeType::Removed || !Change.bTargetable) {
+            RemoveEngagement(Change.Handle);
+        }
+    }
+}
+
+void UEngagementManager::FillSlots(FStructureEngagement& Engagement) {
+    // Destroyed enemies never release their slots themselves
+    for (int32 Index = Engagement.SlotHolders.Num() - 1; Index >= 0; --Index) {
+        if (Engagement.SlotHolders[Index].ResolveObjectPtr()) { continue; }
+        ControllerEngagements.Remove(Engagement.SlotHolders[Index]);
+        Engagement.SlotHolders.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+
+    UAIDirectorManager* AIDirector = nullptr;
+    if (!Engagement.Queue.IsEmpty()) {
+        // Not a dependency, the director depends on this manager
+        AIDirector = UManagerHandlerSubsystem::GetManager<UAIDirectorManager>(GetWorld());
+    }
+
+    int32 NumPromoted = 0;
+    while (Engagement.Queue.IsValidIndex(NumPromoted)
+           && Engagement.SlotHolders.Num() < SlotsPerStructure) {
+        const TObjectKey<ADDAIController> Next = Engagement.Queue[NumPromoted++];
+        ADDAIController* Controller = Next.ResolveObjectPtr();
+        if (!Controller) {
+            ControllerEngagements.Remove(Next);
+            continue;
+        }
+
+        Engagement.SlotHolders.Add(Next);
+        ++TotalPromotions;
+
+        // Waiting enemies idle at a low rate, wake this one up to take its slot straight away.
+        // The tier alone only applies from the decision the enemy has already scheduled
+        if (ADDAICharacter* AICharacter = Controller->GetAICharacter()) {
+            AICharacter->SetSignificanceTier(EAISignificanceTier::High);
+        }
+        if (AIDirector) { AIDirector->WakeAgent(Controller); }
+    }
+    Engagement.Queue.RemoveAt(0, NumPromoted, EAllowShrinking::No);
+}
+
+void UEngagementManager::RemoveEngagement(const FEntityHandle& Structure) {
+    FStructureEngagement Engagement;
+    if (!Engagements.RemoveAndCopyValue(Structure, Engagement)) { return; }
+
+    for (const TObjectKey<ADDAIController>& Controller : Engagement.SlotHolders) {
+        ControllerEngagements.Remove(Controller);
+    }
+    for (const TObjectKey<ADDAIController>& Controller : Engagement.Queue) {
+        ControllerEngagements.Remove(Controller);
+    }
+}
+
+SIZE_T UEngagementManager::GetAllocatedSize() const {
+    SIZE_T Size = Engagements.GetAllocatedSize() + ControllerEngagements.GetAllocatedSize();
+    for (const TPair<FEntityHandle, FStructureEngagement>& Engagement : Engagements) {
+        Size += Engagement.Value.SlotHolders.GetAllocatedSize()
+            + Engagement.Value.Queue.GetAllocatedSize();
+    }
+    return Size;
+}
+
+FString UEngagementManager::GetDebugCategory() const { return TEXT("Engagement"); }
+
+FString UEngagementManager::GetDebugInformation() const {
+    int32 NumQueued = 0;
+    int32 LongestQueue = 0;
+    for (const TPair<FEntityHandle, FStructureEngagement>& Engagement : Engagements) {
+        NumQueued += Engagement.Value.Queue.Num();
+        LongestQueue = FMath::Max(LongestQueue, Engagement.Value.Queue.Num());
+    }
+
+    return FString::Printf(
+        TEXT("Engaged Structures: %d\nSlots Per Structure: %d\nAttacking: %d\nQueued: %d\n"
+            "Longest Queue: %d\nPromotions: %d"),
+        Engagements.Num(),
+        SlotsPerStructure,
+        ControllerEngagements.Num() - NumQueued,
+        NumQueued,
+        LongestQueue,
+        TotalPromotions);
+}
@@ -0,0 +1,242 @@
+#include "Enemies/FlowFieldMovementManager.h"
+
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
+#include "Enemies/AIDirectorManager.h"
+#include "Enemies/CrystalPathFieldManager.h"
+#include "Enemies/DDAICharacter.h"
+
+void UFlowFieldMovementManager::Initialize() {
+    CrystalPathField = UManagerHandlerSubsystem::GetManager<UCrystalPathFieldManager>(GetWorld());
+    ensureAlwaysMsgf(CrystalPathField, TEXT("Flow field movement needs the crystal path field"));
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UFlowFieldMovementManager::Deinitialize() {
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+
+    // Goals came from the old field, the director hands out new ones after reinitializing
+    for (int32 AgentIndex = Characters.Num() - 1; AgentIndex >= 0; --AgentIndex) {
+        RemoveAgentAt(AgentIndex);
+    }
+    CrystalPathField = nullptr;
+}
+
+void UFlowFieldMovementManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UCrystalPathFieldManager::StaticClass());
+    OutDependencies.Add(UAIDirectorManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+void UFlowFieldMovementManager::Tick(const float DeltaTime) {
+    if (Characters.IsEmpty()) { return; }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    GatherAgentState();
+
+    {
+        DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_FlowFieldMovement_Steer);
+        const int32 NumAgents = Characters.Num();
+        ParallelFor(NumAgents,
+                    [this](const int32 AgentIndex) { SteerAgent(AgentIndex); },
+                    NumAgents < ParallelSteeringThreshold);
+    }
+
+    ApplyDirections();
+
+    LastUpdateMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+bool UFlowFieldMovementManager::SetAgentGoal(ADDAICharacter* Character, const FEntityHandle& Goal) {
+    if (!Character) { return false; }
+
+    if (!CrystalPathField || !CrystalPathField->RequestGoalField(Goal)) {
+        RemoveAgent(Character);
+        return false;
+    }
+
+    if (const int32* AgentIndex = AgentIndices.Find(Character)) {
+        Goals[*AgentIndex] = Goal;
+        return true;
+    }
+
+    AgentIndices.Add(Character, Characters.Num());
+    Characters.Add(Character);
+    CharacterKeys.Add(Character);
+    Goals.Add(Goal);
+    Locations.Add(Character->GetActorLocation());
+    Directions.Add(FVector::ZeroVector);
+    CanMove.Add(false);
+    AgentFields.Add(nullptr);
+    AgentCells.Add(FIntPoint::ZeroValue);
+    return true;
+}
+
+void UFlowFieldMovementManager::RemoveAgent(const ADDAICharacter* Character) {
+    if (const int32* AgentIndex = AgentIndices.Find(Character)) { RemoveAgentAt(*AgentIndex); }
+}
+
+bool UFlowFieldMovementManager::IsAgentFollowing(const ADDAICharacter* Character) const {
+    return AgentIndices.Contains(Character);
+}
+
+FVector UFlowFieldMovementManager::GetAgentDirection(const ADDAICharacter* Character) const {
+    const int32* AgentIndex = AgentIndices.Find(Character);
+    return AgentIndex ? Directions[*AgentIndex] : FVector::ZeroVector;
+}
+
+void UFlowFieldMovementManager::GatherAgentState() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_FlowFieldMovement_Gather);
+
+    for (int32 AgentIndex = Characters.Num() - 1; AgentIndex >= 0; --AgentIndex) {
+        const ADDAICharacter* Character = Characters[AgentIndex].Get();
+        if (!Character) {
+            RemoveAgentAt(AgentIndex);
+            continue;
+        }
+
+        Locations[AgentIndex] = Character->GetActorLocation();
+        CanMove[AgentIndex] = Character->GetCurrentPoseState() == EEnemyPoseState::Locomotion;
+        AgentCells[AgentIndex] = GetSeparationCell(Locations[AgentIndex]);
+    }
+
+    // Until a goal field is solved its agents follow the field towards the nearest crystal,
+    // which for most of them is the same crystal
+    const FCrystalPathField* FallbackField = CrystalPathField && CrystalPathField->IsFieldReady()
+                                                 ? &CrystalPathField->GetField()
+                                                 : nullptr;
+    for (int32 AgentIndex = 0; AgentIndex < Characters.Num(); ++AgentIndex) {
+        const FCrystalPathField* GoalField = nullptr;
+        if (CrystalPathField) { GoalField = CrystalPathField->GetGoalField(Goals[AgentIndex]); }
+        AgentFields[AgentIndex] = GoalField ? GoalField : FallbackField;
+    }
+
+    // Sort agents by cell so each occupied cell is one contiguous range
+    SortedAgents.SetNumUninitialized(Characters.Num(), EAllowShrinking::No);
+    for (int32 AgentIndex = 0; AgentIndex < SortedAgents.Num(); ++AgentIndex) {
+        SortedAgents[AgentIndex] = AgentIndex;
+    }
+    Algo::Sort(SortedAgents,
+               [this](const int32 A, const int32 B) {
+                   const FIntPoint& CellA = AgentCells[A];
+                   const FIntPoint& CellB = AgentCells[B];
+                   return CellA.Y != CellB.Y ? CellA.Y < CellB.Y : CellA.X < CellB.X;
+               });
+
+    CellRanges.Reset();
+    for (int32 SortedIndex = 0; SortedIndex < SortedAgents.Num(); ++SortedIndex) {
+        TPair<int32, int32>& Range = CellRanges.FindOrAdd(AgentCells[SortedAgents[SortedIndex]],
+                                                          TPair<int32, int32>(SortedIndex, 0));
+        ++Range.Value;
+    }
+    LastOccupiedCells = CellRanges.Num();
+}
+
+void UFlowFieldMovementManager::SteerAgent(const int32 AgentIndex) {
+    FVector& Direction = Directions[AgentIndex];
+    Direction = FVector::ZeroVector;
+    if (!CanMove[AgentIndex]) { return; }
+
+    const FVector& Location = Locations[AgentIndex];
+    if (const FCrystalPathField* GoalField = AgentFields[AgentIndex]) {
+        GoalField->GetFlowDirection(Location, Direction);
+    }
+
+    // Push away from every agent within the separation radius, harder the closer they are
+    FVector Separation = FVector::ZeroVector;
+    const FIntPoint& Cell = AgentCells[AgentIndex];
+    for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY) {
+        for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX) {
+            const TPair<int32, int32>* Range = CellRanges.Find(
+                FIntPoint(Cell.X + OffsetX, Cell.Y + OffsetY));
+            if (!Range) { continue; }
+
+            for (int32 SortedIndex = Range->Key; SortedIndex < Range->Key + Range->Value;
+                 ++SortedIndex) {
+                const int32 Other = SortedAgents[SortedIndex];
+                if (Other == AgentIndex) { continue; }
+
+                const FVector Away = (Location - Locations[Other]) * FVector(1.0, 1.0, 0.0);
+                const double DistanceSquared = Away.SizeSquared();
+                if (DistanceSquared >= FMath::Square(SeparationRadius)
+                    || DistanceSquared < UE_KINDA_SMALL_NUMBER) {
+                    continue;
+                }
+
+                const double Distance = FMath::Sqrt(DistanceSquared);
+                Separation += Away / Distance * (1.0 - Distance / SeparationRadius);
+            }
+        }
+    }
+
+    Direction = (Direction + Separation * SeparationWeight).GetClampedToMaxSize(1.0);
+}
+
+void UFlowFieldMovementManager::ApplyDirections() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_FlowFieldMovement_Apply);
+
+    for (int32 AgentIndex = 0; AgentIndex < Characters.Num(); ++AgentIndex) {
+        // Field pointers are only valid until the next goal field request
+        AgentFields[AgentIndex] = nullptr;
+
+        if (Directions[AgentIndex].IsNearlyZero()) { continue; }
+
+        if (ADDAICharacter* Character = Characters[AgentIndex].Get()) {
+            Character->AddMovementInput(Directions[AgentIndex]);
+        }
+    }
+}
+
+void UFlowFieldMovementManager::RemoveAgentAt(const int32 AgentIndex) {
+    const int32 LastIndex = Characters.Num() - 1;
+    AgentIndices.Remove(CharacterKeys[AgentIndex]);
+    if (AgentIndex != LastIndex) { AgentIndices.Add(CharacterKeys[LastIndex], AgentIndex); }
+
+    Characters.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    CharacterKeys.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    Goals.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    Locations.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    Directions.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    AgentFields.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+    AgentCells.RemoveAtSwap(AgentIndex, 1, EAllowShrinking::No);
+
+    // TBitArray has no swap-removal, so move the last bit down by hand
+    if (AgentIndex != LastIndex) { CanMove[AgentIndex] = CanMove[LastIndex]; }
+    CanMove.RemoveAt(LastIndex);
+}
+
+FIntPoint UFlowFieldMovementManager::GetSeparationCell(const FVector& Location) const {
+    return FIntPoint(FMath::FloorToInt(Location.X / SeparationRadius),
+                     FMath::FloorToInt(Location.Y / SeparationRadius));
+}
+
+SIZE_T UFlowFieldMovementManager::GetAllocatedSize() const {
+    return Characters.GetAllocatedSize() + CharacterKeys.GetAllocatedSize()
+           + Goals.GetAllocatedSize() + Locations.GetAllocatedSize()
+           + Directions.GetAllocatedSize() + CanMove.GetAllocatedSize()
+           + AgentFields.GetAllocatedSize() + AgentIndices.GetAllocatedSize()
+           + SortedAgents.GetAllocatedSize() + AgentCells.GetAllocatedSize()
+           + CellRanges.GetAllocatedSize();
+}
+
+FString UFlowFieldMovementManager::GetDebugCategory() const { return TEXT("Flow Field Movement"); }
+
+FString UFlowFieldMovementManager::GetDebugInformation() const {
+    return FString::Printf(
+        TEXT("Agents: %d\nOccupied Cells: %d\nUpdate: %.3fms"),
+        Characters.Num(),
+        LastOccupiedCells,
+        LastUpdateMs);
+}
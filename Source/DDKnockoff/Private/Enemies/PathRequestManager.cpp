@@ -0,0 +1,216 @@
+#include "Enemies/PathRequestManager.h"
+
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
+#include "Enemies/AIDirectorManager.h"
+#include "Enemies/DDAIController.h"
+#include "NavigationSystem.h"
+
+void UPathRequestManager::Initialize() {
+    LastDispatched = 0;
+    TotalRequests = 0;
+    TotalQueries = 0;
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UPathRequestManager::Deinitialize() {
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
+
+    // Results of aborted queries are never delivered, so waiting controllers simply go idle
+    if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+        GetWorld())) {
+        for (const TPair<uint32, FPathRequestKey>& Query : InFlightQueries) {
+            NavSys->AbortAsyncFindPathRequest(Query.Key);
+        }
+    }
+
+    Groups.Empty();
+    QueuedKeys.Empty();
+    InFlightQueries.Empty();
+    ControllerRequests.Empty();
+}
+
+void UPathRequestManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UAIDirectorManager::StaticClass());
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+void UPathRequestManager::Tick(const float DeltaTime) {
+    LastDispatched = 0;
+    if (!QueuedKeys.IsEmpty()) { DispatchQueries(); }
+}
+
+void UPathRequestManager::RequestPath(ADDAIController* Controller,
+                                      const FVector& Start,
+                                      AActor& Goal,
+                                      const FNavAgentProperties& AgentProperties) {
+    if (!Controller) { return; }
+
+    ++TotalRequests;
+
+    const FPathRequestKey Key = MakeKey(Start, Goal);
+    if (const FPathRequestKey* PendingKey = ControllerRequests.Find(Controller)) {
+        if (*PendingKey == Key) { return; }
+        CancelRequest(Controller);
+    }
+
+    FPathRequestGroup* Group = Groups.Find(Key);
+    if (!Group) {
+        Group = &Groups.Add(Key);
+        Group->Start = Start;
+        Group->Goal = &Goal;
+        Group->AgentProperties = AgentProperties;
+        QueuedKeys.Add(Key);
+    }
+
+    Group->Waiting.Add(Controller);
+    ControllerRequests.Add(Controller, Key);
+}
+
+void UPathRequestManager::CancelRequest(const ADDAIController* Controller) {
+    FPathRequestKey Key;
+    if (!ControllerRequests.RemoveAndCopyValue(Controller, Key)) { return; }
+
+    FPathRequestGroup* Group = Groups.Find(Key);
+    if (!Group) { return; }
+
+    Group->Waiting.RemoveSingleSwap(TObjectKey<ADDAIController>(Controller), EAllowShrinking::No);
+    if (!Group->Waiting.IsEmpty()) { return; }
+
+    // Nobody is left waiting, so the query is not worth finishing
+    if (Group->QueryId != 0) {
+        if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+            GetWorld())) {
+            NavSys->AbortAsyncFindPathRequest(Group->QueryId);
+        }
+        InFlightQueries.Remove(Group->QueryId);
+    } else { QueuedKeys.Remove(Key); }
+    Groups.Remove(Key);
+}
+
+bool UPathRequestManager::IsRequestPending(const ADDAIController* Controller) const {
+    return ControllerRequests.Contains(Controller);
+}
+
+void UPathRequestManager::DispatchQueries() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_PathRequests_Dispatch);
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    if (!NavSys) { return; }
+
+    int32 NumConsumed = 0;
+    while (QueuedKeys.IsValidIndex(NumConsumed) && LastDispatched < MaxQueriesPerFrame
+           && InFlightQueries.Num() < MaxQueriesInFlight) {
+        const FPathRequestKey Key = QueuedKeys[NumConsumed++];
+        FPathRequestGroup* Group = Groups.Find(Key);
+        if (!Group) { continue; }
+
+        const AActor* Goal = Group->Goal.Get();
+        const ANavigationData* NavData =
+            Goal ? NavSys->GetNavDataForProps(Group->AgentProperties, Group->Start) : nullptr;
+        if (!NavData) {
+            // Nothing to path on or to, the controllers go idle and the director asks again
+            for (const TObjectKey<ADDAIController>& Controller : Group->Waiting) {
+                ControllerRequests.Remove(Controller);
+            }
+            Groups.Remove(Key);
+            continue;
+        }
+
+        // Match MoveTo, which projects the goal onto the navmesh and accepts partial paths
+        FVector GoalLocation = Goal->GetActorLocation();
+        FNavLocation ProjectedGoal;
+        if (NavSys->ProjectPointToNavigation(GoalLocation,
+                                             ProjectedGoal,
+                                             INVALID_NAVEXTENT,
+                                             NavData)) {
+            GoalLocation = ProjectedGoal.Location;
+        }
+
+        FPathFindingQuery Query(this, *NavData, Group->Start, GoalLocation);
+        Query.SetAllowPartialPaths(true);
+
+        Group->QueryId = NavSys->FindPathAsync(
+            Group->AgentProperties,
+            Query,
+            FNavPathQueryDelegate::CreateUObject(this, &UPathRequestManager::OnPathFound));
+        InFlightQueries.Add(Group->QueryId, Key);
+
+        ++LastDispatched;
+        ++TotalQueries;
+    }
+
+    QueuedKeys.RemoveAt(0, NumConsumed, EAllowShrinking::No);
+}
+
+void UPathRequestManager::OnPathFound(const uint32 QueryId,
+                                      const ENavigationQueryResult::Type Result,
+                                      const FNavPathSharedPtr Path) {
+    FPathRequestKey Key;
+    if (!InFlightQueries.RemoveAndCopyValue(QueryId, Key)) { return; }
+
+    FPathRequestGroup Group;
+    if (!Groups.RemoveAndCopyValue(Key, Group)) { return; }
+
+    AActor* Goal = Group.Goal.Get();
+    const bool bFound = Goal && Path.IsValid() && Result == ENavigationQueryResult::Success
+                        && !Path->GetPathPoints().IsEmpty();
+
+    // Everyone follows the query's path, which repaths itself when the navmesh changes. The
+    // waiters all started within one region, and path following starts each of them on the
+    // segment nearest to it, again after every repath
+    if (bFound) { Path->EnableRecalculationOnInvalidation(true); }
+
+    for (const TObjectKey<ADDAIController>& ControllerKey : Group.Waiting) {
+        // Destroyed controllers are dropped too, or their lookup entries would linger
+        ControllerRequests.Remove(ControllerKey);
+
+        ADDAIController* Controller = ControllerKey.ResolveObjectPtr();
+        if (!bFound || !Controller || !Controller->GetPawn()) { continue; }
+
+        Controller->FollowPath(Path, *Goal);
+    }
+}
+
+FPathRequestKey UPathRequestManager::MakeKey(const FVector& Start, const AActor& Goal) const {
+    FPathRequestKey Key;
+    Key.StartRegion = FIntVector(FMath::FloorToInt(Start.X / StartRegionSize),
+                                 FMath::FloorToInt(Start.Y / StartRegionSize),
+                                 FMath::FloorToInt(Start.Z / StartRegionSize));
+    Key.Goal = &Goal;
+    return Key;
+}
+
+SIZE_T UPathRequestManager::GetAllocatedSize() const {
+    SIZE_T Size = Groups.GetAllocatedSize() + QueuedKeys.GetAllocatedSize()
+                  + InFlightQueries.GetAllocatedSize() + ControllerRequests.GetAllocatedSize();
+    for (const TPair<FPathRequestKey, FPathRequestGroup>& Group : Groups) {
+        Size += Group.Value.Waiting.GetAllocatedSize();
+    }
+    return Size;
+}
+
+FString UPathRequestManager::GetDebugCategory() const { return TEXT("Path Requests"); }
+
+FString UPathRequestManager::GetDebugInformation() const {
+    const float ShareRatio = TotalQueries > 0
+                                 ? static_cast<float>(TotalRequests) / TotalQueries
+                                 : 0.0f;
+    return FString::Printf(
+        TEXT("Queued: %d\nIn Flight: %d\nWaiting Controllers: %d\nDispatched: %d\n"
+            "Requests Per Query: %.2f"),
+        QueuedKeys.Num(),
+        InFlightQueries.Num(),
+        ControllerRequests.Num(),
+        LastDispatched,
+        ShareRatio);
+}
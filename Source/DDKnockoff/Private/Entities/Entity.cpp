@@ -1,3 +1,9 @@
 ﻿#include "Entities/Entity.h"
+#include "Entities/EntityData.h"
 
 bool IEntity::IsCurrentlyTargetable() const { return true; }
+
+FEntityHandle IEntity::GetEntityHandle() const {
+    const UEntityData* EntityData = GetEntityData();
+    return EntityData ? EntityData->GetHandle() : FEntityHandle();
+}
@@ -1,98 +1,389 @@
 #include "Entities/EntityManager.h"
+#include "Core/DDKnockoffStats.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Debug/DebugInformationManager.h"
 #include "Entities/Entity.h"
 #include "Entities/EntityData.h"
+#include "GameFramework/Actor.h"
+#include "Health/HealthComponent.h"
+#include "UObject/UObjectGlobals.h"
 
 UEntityManager::UEntityManager() {
     // No initialization needed
 }
 
-void UEntityManager::Deinitialize() {}
+void UEntityManager::Deinitialize() {
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+    PostGarbageCollectHandle.Reset();
 
-void UEntityManager::Initialize() {}
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->UnregisterDebugInformationProvider(this);
+    }
 
-void UEntityManager::RegisterEntity(IEntity* Entity) {
-    if (!Entity) { return; }
+    // Apply and deliver everything from before the refresh, so no subscriber misses a change
+    CommitPendingOperations();
+    DispatchChangeJournal();
+
+    // Registered entities, subscriptions, archetypes and systems belong to their owners and
+    // outlive a refresh, only play-time rows are dropped
+    for (const TPair<FName, TSharedPtr<FEntityArchetypeBase>>& Archetype : Archetypes) {
+        Archetype.Value->Reset();
+    }
+}
+
+void UEntityManager::Tick(const float DeltaTime) {
+    CommitPendingOperations();
+
+    {
+        // Systems registering or unregistering systems would change the array under the loop
+        TGuardValue<bool> RunningSystemsGuard(bRunningArchetypeSystems, true);
+        for (const TPair<FName, TFunction<void(float)>>& System : ArchetypeSystems) {
+            System.Value(DeltaTime);
+        }
+    }
+    ApplyPendingArchetypeSystemChanges();
+
+    // Tighten the spatial bounds left loose by this frame's removals
+    SpatialHash.ShrinkBounds();
+
+    // Published on the first GetSnapshot of the frame, so frames without readers copy nothing
+    bSnapshotDirty = true;
+    DispatchChangeJournal();
+
+    SET_DWORD_STAT(STAT_EntityManager_NumEntities, AllEntities.Entities.Num());
+}
+
+void UEntityManager::Initialize() {
+    // Statistics count from this initialization, starting with the entities that survived it
+    Stats = FEntityManagerStats();
+    for (const int32 SlotIndex : AllEntities.SlotIndices) {
+        Stats.AddToBuckets(Slots[SlotIndex].Faction, Slots[SlotIndex].Type);
+    }
+
+    // Subscribers initialized after this manager start from scratch, replay the registry to them
+    for (const int32 SlotIndex : AllEntities.SlotIndices) {
+        RecordChange(EEntityChangeType::Added, SlotIndex);
+    }
+
+    bSnapshotDirty = true;
+
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(
+        this,
+        &UEntityManager::OnPostGarbageCollect);
+
+    if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
+        UDebugInformationManager>(GetWorld())) {
+        DebugSubsystem->RegisterDebugInformationProvider(this);
+    }
+}
+
+void UEntityManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+}
+
+FEntityHandle UEntityManager::RegisterEntity(IEntity* Entity) {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_RegisterEntity);
+
+    if (!Entity) { return FEntityHandle(); }
 
     UObject* Object = Cast<UObject>(Entity);
-    if (!Object || !Object->GetClass()->ImplementsInterface(UEntity::StaticClass())) { return; }
+    if (!Object || !Object->GetClass()->ImplementsInterface(UEntity::StaticClass())) {
+        return FEntityHandle();
+    }
 
     UEntityData* EntityData = Entity->GetEntityData();
-    if (!EntityData) { return; }
+    if (!EntityData) { return FEntityHandle(); }
+
+    // A second slot would never be released, unregistering only frees the one the handle names
+    const FEntitySlot* RegisteredSlot = FindOccupiedSlot(EntityData->GetHandle());
+    if (RegisteredSlot && RegisteredSlot->Entity.GetObject() == Object) {
+        ensureAlwaysMsgf(false,
+                         TEXT("EntityManager: %s is already registered"),
+                         *Object->GetName());
+        return EntityData->GetHandle();
+    }
+
+    const int32 SlotIndex = AllocateSlot();
+    if (SlotIndex == INDEX_NONE) {
+        UE_LOG(LogTemp, Error, TEXT("EntityManager: Out of entity slots, cannot register %s"),
+               *Object->GetName());
+        return FEntityHandle();
+    }
 
     // Create interface reference
     TScriptInterface<IEntity> InterfaceRef;
     InterfaceRef.SetObject(Object);
     InterfaceRef.SetInterface(Entity);
 
-    // Add to main map
+    // Occupy the slot and hand the handle back to the entity
+    FEntitySlot& Slot = Slots[SlotIndex];
+    Slot.Entity = InterfaceRef;
+    Slot.bOccupied = true;
+    Slot.Faction = Entity->GetFaction();
+    Slot.Type = Entity->GetEntityType();
+
+    const FEntityHandle Handle(SlotIndex, Slot.Generation);
     EntityData->InitialiseID();
-    EntityMap.Add(EntityData->GetID(), InterfaceRef);
+    EntityData->SetHandle(Handle);
 
-    // Add to faction map
-    const EFaction Faction = Entity->GetFaction();
-    if (!FactionMap.Contains(Faction)) { FactionMap.Add(Faction, FEntityArray()); }
-    FactionMap[Faction].Entities.Add(InterfaceRef);
+    ++MutationSerial;
 
-    // Add to type map
-    const EEntityType Type = Entity->GetEntityType();
-    if (!TypeMap.Contains(Type)) { TypeMap.Add(Type, FEntityArray()); }
-    TypeMap[Type].Entities.Add(InterfaceRef);
+    // Add to every bucket, remembering the position for O(1) removal
+    Slot.FactionIndex = AddToBucket(FactionMap.FindOrAdd(Slot.Faction), SlotIndex);
+    Slot.TypeIndex = AddToBucket(TypeMap.FindOrAdd(Slot.Type), SlotIndex);
+    Slot.FactionAndTypeIndex = AddToBucket(
+        FactionAndTypeMap.FindOrAdd(FFactionTypeKey(Slot.Faction, Slot.Type)),
+        SlotIndex);
+    Slot.AllEntitiesIndex = AddToBucket(AllEntities, SlotIndex);
 
-    // Add to faction and type map
-    const FFactionTypeKey FactionAndType(Faction, Type);
-    if (!FactionAndTypeMap.Contains(FactionAndType)) {
-        FactionAndTypeMap.Add(FactionAndType, FEntityArray());
-    }
-    FactionAndTypeMap[FactionAndType].Entities.Add(InterfaceRef);
+    Stats.AddToBuckets(Slot.Faction, Slot.Type);
+    ++Stats.TotalRegistered;
+
+    // Seed the hot data alongside AllEntities so both share an index
+    const AActor* Actor = Entity->GetActor();
+    const UHealthComponent* HealthComponent = Actor
+                                                  ? Actor->FindComponentByClass<UHealthComponent>()
+                                                  : nullptr;
+    const int32 HotIndex = HotData.Add(Handle,
+                                       Slot.Faction,
+                                       Slot.Type,
+                                       Actor ? Actor->GetActorLocation() : FVector::ZeroVector,
+                                       HealthComponent ? HealthComponent->GetCurrentHealth() : 0.0f,
+                                       Entity->IsCurrentlyTargetable());
+    check(HotIndex == Slot.AllEntitiesIndex);
 
-    // Update cached array
-    AllEntities.Add(InterfaceRef);
+    StartSpatialTracking(SlotIndex);
+    RecordChange(EEntityChangeType::Added, SlotIndex);
+
+    return Handle;
 }
 
 void UEntityManager::UnregisterEntity(IEntity* Entity) {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_UnregisterEntity);
+
     if (!Entity) { return; }
 
-    const UEntityData* EntityData = Entity->GetEntityData();
+    UEntityData* EntityData = Entity->GetEntityData();
     if (!EntityData) { return; }
 
-    const FGuid ID = EntityData->GetID();
+    // Only the entity currently occupying the handle's slot may release it
+    const FEntityHandle Handle = EntityData->GetHandle();
+    const FEntitySlot* Slot = FindOccupiedSlot(Handle);
+    if (!Slot || Slot->Entity.GetObject() != Cast<UObject>(Entity)) { return; }
 
-    // Find and remove from main map
-    const TScriptInterface<IEntity>* InterfaceRef = EntityMap.Find(ID);
-    if (!InterfaceRef) { return; }
+    UnregisterSlot(Handle.GetIndex());
+    EntityData->SetHandle(FEntityHandle());
+}
 
-    // Cache values before removal
-    const EFaction Faction = Entity->GetFaction();
-    const EEntityType Type = Entity->GetEntityType();
+void UEntityManager::UnregisterSlot(const int32 SlotIndex) {
+    const FEntitySlot& Slot = Slots[SlotIndex];
+    const FEntityHandle Handle = MakeHandle(SlotIndex);
+    const TScriptInterface<IEntity> InterfaceRef = Slot.Entity;
+    const EFaction Faction = Slot.Faction;
+    const EEntityType Type = Slot.Type;
 
-    // Lambda for ID comparison - reused across all collections
-    auto RemoveByID = [&ID](const TScriptInterface<IEntity>& Item) {
-        return Item->GetEntityData() && Item->GetEntityData()->GetID() == ID;
-    };
+    // Journal before the hot data entry goes so the record keeps the final targetability
+    RecordChange(EEntityChangeType::Removed, SlotIndex);
+
+    ++MutationSerial;
+
+    // Swap-remove from all collections using the positions stored on the slot
+    RemoveFromBucket(FactionMap.FindChecked(Faction),
+                     Slots[SlotIndex].FactionIndex,
+                     &FEntitySlot::FactionIndex);
+    RemoveFromBucket(TypeMap.FindChecked(Type), Slots[SlotIndex].TypeIndex, &FEntitySlot::TypeIndex);
+    RemoveFromBucket(FactionAndTypeMap.FindChecked(FFactionTypeKey(Faction, Type)),
+                     Slots[SlotIndex].FactionAndTypeIndex,
+                     &FEntitySlot::FactionAndTypeIndex);
+    HotData.RemoveAtSwap(Slots[SlotIndex].AllEntitiesIndex);
+    RemoveFromBucket(AllEntities,
+                     Slots[SlotIndex].AllEntitiesIndex,
+                     &FEntitySlot::AllEntitiesIndex);
+
+    Stats.RemoveFromBuckets(Faction, Type);
+    ++Stats.TotalUnregistered;
+
+    StopSpatialTracking(SlotIndex);
+
+    FEntityRemovalRecord& RemovalRecord = PendingRemovalRecords.AddDefaulted_GetRef();
+    RemovalRecord.Handle = Handle;
+    RemovalRecord.Faction = Faction;
+    RemovalRecord.Type = Type;
 
-    // Remove from all collections
-    if (FEntityArray* FactionArray = FactionMap.Find(Faction)) {
-        FactionArray->Entities.RemoveAll(RemoveByID);
+    // Broadcast removal event before releasing the slot so listeners can still resolve the handle.
+    // A collected entity is left to the batched record, listeners have nothing to inspect
+    if (InterfaceRef.GetObject()) { OnEntityRemoved.Broadcast(InterfaceRef); }
+
+    // Finally release the slot, invalidating any outstanding handles
+    ReleaseSlot(SlotIndex);
+}
+
+void UEntityManager::ReleaseCollectedSlots() {
+    // Walk backwards, releasing a slot swaps the last entry into its place
+    for (int32 Index = AllEntities.SlotIndices.Num() - 1; Index >= 0; --Index) {
+        const int32 SlotIndex = AllEntities.SlotIndices[Index];
+        if (!Slots[SlotIndex].Entity.GetObject()) { UnregisterSlot(SlotIndex); }
     }
+}
 
-    if (FEntityArray* TypeArray = TypeMap.Find(Type)) { TypeArray->Entities.RemoveAll(RemoveByID); }
+void UEntityManager::QueueRegister(IEntity* Entity) {
+    UObject* Object = Cast<UObject>(Entity);
+    if (!Object) { return; }
 
-    const FFactionTypeKey FactionAndType(Faction, Type);
-    if (FEntityArray* FactionTypeArray = FactionAndTypeMap.Find(FactionAndType)) {
-        FactionTypeArray->Entities.RemoveAll(RemoveByID);
+    FPendingEntityOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+    Operation.Entity.SetObject(Object);
+    Operation.Entity.SetInterface(Entity);
+    Operation.bRegister = true;
+}
+
+void UEntityManager::QueueUnregister(IEntity* Entity) {
+    UObject* Object = Cast<UObject>(Entity);
+    if (!Object) { return; }
+
+    // An entity that never made it into the registry just drops its pending registration
+    const int32 PendingRegisterIndex = PendingOperations.FindLastByPredicate(
+        [Object](const FPendingEntityOperation& Operation) {
+            return Operation.bRegister && Operation.Entity.GetObject() == Object;
+        });
+    if (PendingRegisterIndex != INDEX_NONE) {
+        PendingOperations.RemoveAt(PendingRegisterIndex);
+        return;
+    }
+
+    // Capture the handle now, garbage collection may null the entity before the commit
+    const UEntityData* EntityData = Entity->GetEntityData();
+    const FEntityHandle Handle = EntityData ? EntityData->GetHandle() : FEntityHandle();
+    const FEntitySlot* Slot = FindOccupiedSlot(Handle);
+    if (!Slot || Slot->Entity.GetObject() != Object) { return; }
+
+    FPendingEntityOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+    Operation.Entity.SetObject(Object);
+    Operation.Entity.SetInterface(Entity);
+    Operation.Handle = Handle;
+    Operation.bRegister = false;
+}
+
+void UEntityManager::CommitPendingOperations() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_CommitPendingOperations);
+
+    // Swap out the queue so anything queued by event listeners lands in the next commit
+    TArray<FPendingEntityOperation> Operations = MoveTemp(PendingOperations);
+    PendingOperations.Reset();
+
+    for (const FPendingEntityOperation& Operation : Operations) {
+        if (!Operation.bRegister) {
+            // Queued twice, or released by the collected entity sweep
+            if (!FindOccupiedSlot(Operation.Handle)) { continue; }
+
+            UnregisterSlot(Operation.Handle.GetIndex());
+
+            // The interface pointer outlives a collected object, only trust it with the object
+            UEntityData* EntityData = Operation.Entity.GetObject()
+                                          ? Operation.Entity->GetEntityData()
+                                          : nullptr;
+            if (EntityData) { EntityData->SetHandle(FEntityHandle()); }
+            continue;
+        }
+
+        // A registration whose entity was collected before the commit has nothing to register
+        if (IEntity* Entity = Operation.Entity.GetInterface()) { RegisterEntity(Entity); }
+    }
+
+    // Entities collected without unregistering would otherwise hold their slots forever
+    if (bCollectedSinceCommit) {
+        bCollectedSinceCommit = false;
+        ReleaseCollectedSlots();
     }
 
-    AllEntities.RemoveAll(RemoveByID);
+    if (PendingRemovalRecords.IsEmpty()) { return; }
+
+    const TArray<FEntityRemovalRecord> RemovalRecords = MoveTemp(PendingRemovalRecords);
+    PendingRemovalRecords.Reset();
+    OnEntitiesRemoved.Broadcast(RemovalRecords);
+}
+
+FDelegateHandle UEntityManager::SubscribeToChanges(const FEntityChangeFilter& Filter,
+                                                   FOnEntityChangesDelegate Delegate) {
+    FEntityChangeSubscription& Subscription = ChangeSubscriptions.AddDefaulted_GetRef();
+    Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+    Subscription.Filter = Filter;
+    Subscription.Delegate = MoveTemp(Delegate);
+    return Subscription.Handle;
+}
+
+void UEntityManager::UnsubscribeFromChanges(const FDelegateHandle Handle) {
+    const int32 Index = ChangeSubscriptions.IndexOfByPredicate(
+        [Handle](const FEntityChangeSubscription& Subscription) {
+            return Subscription.Handle == Handle;
+        });
+    if (Index == INDEX_NONE) { return; }
+
+    // Mid-dispatch the array is being walked, so just unbind and let the dispatch compact it
+    if (bDispatchingChanges) {
+        ChangeSubscriptions[Index].Delegate.Unbind();
+        return;
+    }
+    ChangeSubscriptions.RemoveAt(Index);
+}
 
-    // Broadcast removal event before removing from main map
-    OnEntityRemoved.Broadcast(*InterfaceRef);
+void UEntityManager::DispatchChangeJournal() {
+    if (ChangeJournal.IsEmpty() || bDispatchingChanges) { return; }
+
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_DispatchChangeJournal);
+
+    // Swap out the journal so records written by subscribers land in the next dispatch
+    const TArray<FEntityChangeRecord> Records = MoveTemp(ChangeJournal);
+    ChangeJournal.Reset();
+
+    bDispatchingChanges = true;
+
+    TArray<FEntityChangeRecord> MatchingRecords;
+    for (int32 Index = 0; Index < ChangeSubscriptions.Num(); ++Index) {
+        MatchingRecords.Reset();
+        const FEntityChangeFilter& Filter = ChangeSubscriptions[Index].Filter;
+        for (const FEntityChangeRecord& Record : Records) {
+            if (Filter.Matches(Record)) { MatchingRecords.Add(Record); }
+        }
+        if (MatchingRecords.IsEmpty()) { continue; }
+
+        // Copy the delegate - subscribing from a callback may reallocate the array
+        const FOnEntityChangesDelegate Delegate = ChangeSubscriptions[Index].Delegate;
+        Delegate.ExecuteIfBound(MatchingRecords);
+    }
+
+    bDispatchingChanges = false;
+
+    // Drop subscriptions removed mid-dispatch or whose bound object has been destroyed
+    ChangeSubscriptions.RemoveAll([](const FEntityChangeSubscription& Subscription) {
+        return !Subscription.Delegate.IsBound();
+    });
+}
+
+IEntity* UEntityManager::ResolveEntity(const FEntityHandle& Handle) const {
+    const FEntitySlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->Entity.GetInterface() : nullptr;
+}
+
+TScriptInterface<IEntity> UEntityManager::GetEntity(const FEntityHandle& Handle) const {
+    const FEntitySlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->Entity : TScriptInterface<IEntity>();
+}
+
+AActor* UEntityManager::ResolveActor(const FEntityHandle& Handle) const {
+    IEntity* Entity = ResolveEntity(Handle);
+    return Entity ? Entity->GetActor() : nullptr;
+}
 
-    // Finally remove from main map
-    EntityMap.Remove(ID);
+bool UEntityManager::IsHandleValid(const FEntityHandle& Handle) const {
+    return FindSlot(Handle) != nullptr;
 }
 
 TScriptInterface<IEntity> UEntityManager::GetEntityByID(const FGuid& ID) const {
-    if (const TScriptInterface<IEntity>* Found = EntityMap.Find(ID)) { return *Found; }
+    for (const TScriptInterface<IEntity>& Entity : AllEntities.Entities) {
+        const UEntityData* EntityData = Entity ? Entity->GetEntityData() : nullptr;
+        if (EntityData && EntityData->GetID() == ID) { return Entity; }
+    }
     return TScriptInterface<IEntity>();
 }
 
@@ -115,3 +406,517 @@ TArray<TScriptInterface<IEntity>> UEntityManager::GetEntitiesByFactionAndType(
     }
     return TArray<TScriptInterface<IEntity>>();
 }
+
+FEntityView UEntityManager::ViewEntitiesByFaction(const EFaction Faction) const {
+    return MakeView(FactionMap.Find(Faction));
+}
+
+FEntityView UEntityManager::ViewEntitiesByType(const EEntityType Type) const {
+    return MakeView(TypeMap.Find(Type));
+}
+
+FEntityView UEntityManager::ViewEntitiesByFactionAndType(const EFaction Faction,
+                                                         const EEntityType Type) const {
+    return MakeView(FactionAndTypeMap.Find(FFactionTypeKey(Faction, Type)));
+}
+
+int32 UEntityManager::CountByFaction(const EFaction Faction) const {
+    const FEntityArray* Found = FactionMap.Find(Faction);
+    return Found ? Found->Entities.Num() : 0;
+}
+
+int32 UEntityManager::CountByType(const EEntityType Type) const {
+    const FEntityArray* Found = TypeMap.Find(Type);
+    return Found ? Found->Entities.Num() : 0;
+}
+
+int32 UEntityManager::CountByFactionAndType(const EFaction Faction, const EEntityType Type) const {
+    const FEntityArray* Found = FactionAndTypeMap.Find(FFactionTypeKey(Faction, Type));
+    return Found ? Found->Entities.Num() : 0;
+}
+
+void UEntityManager::QueryRadius(const EFaction Faction,
+                                 const EEntityType Type,
+                                 const FVector& Center,
+                                 const float Radius,
+                                 TArray<FEntityHandle>& OutHandles) const {
+    FEntityQueryFilter Filter;
+    Filter.Faction = Faction;
+    Filter.Type = Type;
+    QueryRadius(Filter, Center, Radius, OutHandles);
+}
+
+void UEntityManager::QueryRadius(const FEntityQueryFilter& Filter,
+                                 const FVector& Center,
+                                 const float Radius,
+                                 TArray<FEntityHandle>& OutHandles) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_QueryRadius);
+
+    OutHandles.Reset();
+    SpatialHash.ForEachInRadius(Center,
+                                Radius,
+                                [&](const int32 SlotIndex, float) {
+                                    if (SlotMatches(SlotIndex, Filter)) {
+                                        OutHandles.Add(MakeHandle(SlotIndex));
+                                    }
+                                });
+}
+
+void UEntityManager::QueryRadius(const FVector& Center,
+                                 const float Radius,
+                                 const TFunctionRef<bool(IEntity&)> Filter,
+                                 TArray<FEntityHandle>& OutHandles) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_QueryRadius);
+
+    OutHandles.Reset();
+    SpatialHash.ForEachInRadius(Center,
+                                Radius,
+                                [&](const int32 SlotIndex, float) {
+                                    if (IsSlotLive(SlotIndex) && Filter(*Slots[SlotIndex].Entity)) {
+                                        OutHandles.Add(MakeHandle(SlotIndex));
+                                    }
+                                });
+}
+
+void UEntityManager::FindNearest(const EFaction Faction,
+                                 const EEntityType Type,
+                                 const FVector& Center,
+                                 const int32 Count,
+                                 TArray<FEntityHandle>& OutHandles,
+                                 const float MaxRadius) const {
+    FEntityQueryFilter Filter;
+    Filter.Faction = Faction;
+    Filter.Type = Type;
+    FindNearest(Filter, Center, Count, OutHandles, MaxRadius);
+}
+
+void UEntityManager::FindNearest(const FEntityQueryFilter& Filter,
+                                 const FVector& Center,
+                                 const int32 Count,
+                                 TArray<FEntityHandle>& OutHandles,
+                                 const float MaxRadius) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_FindNearest);
+
+    TArray<int32> NearestSlots;
+    SpatialHash.FindNearest(Center,
+                            Count,
+                            MaxRadius,
+                            [&](const int32 SlotIndex) { return SlotMatches(SlotIndex, Filter); },
+                            NearestSlots);
+
+    OutHandles.Reset(NearestSlots.Num());
+    for (const int32 SlotIndex : NearestSlots) { OutHandles.Add(MakeHandle(SlotIndex)); }
+}
+
+void UEntityManager::FindNearest(const FVector& Center,
+                                 const int32 Count,
+                                 const TFunctionRef<bool(IEntity&)> Filter,
+                                 TArray<FEntityHandle>& OutHandles,
+                                 const float MaxRadius) const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_FindNearest);
+
+    TArray<int32> NearestSlots;
+    SpatialHash.FindNearest(Center,
+                            Count,
+                            MaxRadius,
+                            [&](const int32 SlotIndex) {
+                                return IsSlotLive(SlotIndex) && Filter(*Slots[SlotIndex].Entity);
+                            },
+                            NearestSlots);
+
+    OutHandles.Reset(NearestSlots.Num());
+    for (const int32 SlotIndex : NearestSlots) { OutHandles.Add(MakeHandle(SlotIndex)); }
+}
+
+FEntityArchetypeBase* UEntityManager::FindArchetype(const FName Name) const {
+    const TSharedPtr<FEntityArchetypeBase>* Found = Archetypes.Find(Name);
+    return Found ? Found->Get() : nullptr;
+}
+
+int32 UEntityManager::CountArchetypeRows(const EFaction Faction, const EEntityType Type) const {
+    int32 RowCount = 0;
+    for (const TPair<FName, TSharedPtr<FEntityArchetypeBase>>& Pair : Archetypes) {
+        if (Pair.Value->GetFaction() == Faction && Pair.Value->GetType() == Type) {
+            RowCount += Pair.Value->Num();
+        }
+    }
+    return RowCount;
+}
+
+void UEntityManager::RegisterArchetypeSystem(const FName Name, TFunction<void(float)> System) {
+    check(System);
+    if (bRunningArchetypeSystems) {
+        PendingArchetypeSystemChanges.Emplace(Name, MoveTemp(System));
+        return;
+    }
+
+    check(!ArchetypeSystems.ContainsByPredicate(
+        [Name](const TPair<FName, TFunction<void(float)>>& Pair) { return Pair.Key == Name; }));
+    ArchetypeSystems.Emplace(Name, MoveTemp(System));
+}
+
+void UEntityManager::UnregisterArchetypeSystem(const FName Name) {
+    if (bRunningArchetypeSystems) {
+        PendingArchetypeSystemChanges.Emplace(Name, nullptr);
+        return;
+    }
+
+    ArchetypeSystems.RemoveAll([Name](const TPair<FName, TFunction<void(float)>>& Pair) {
+        return Pair.Key == Name;
+    });
+}
+
+void UEntityManager::ApplyPendingArchetypeSystemChanges() {
+    if (PendingArchetypeSystemChanges.IsEmpty()) { return; }
+
+    // Applied in the order they were made, so unregistering then registering a name replaces it
+    TArray<TPair<FName, TFunction<void(float)>>> Changes = MoveTemp(PendingArchetypeSystemChanges);
+    for (TPair<FName, TFunction<void(float)>>& Change : Changes) {
+        if (Change.Value) { RegisterArchetypeSystem(Change.Key, MoveTemp(Change.Value)); } else {
+            UnregisterArchetypeSystem(Change.Key);
+        }
+    }
+}
+
+IEntity* UEntityManager::MaterializeProxy(const FName ArchetypeName,
+                                         const FArchetypeRowHandle& Row) {
+    FEntityArchetypeBase* Archetype = FindArchetype(ArchetypeName);
+    if (!Archetype || !Archetype->IsRowValid(Row) || !Archetype->GetProxyFactory()) {
+        return nullptr;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World) { return nullptr; }
+
+    // The proxy registers itself like any other entity, the row just stops existing
+    IEntity* Proxy = Archetype->GetProxyFactory()(*World, *Archetype, Row);
+    if (Proxy) { Archetype->RemoveRow(Row); }
+    return Proxy;
+}
+
+FString UEntityManager::GetDebugCategory() const { return TEXT("Entities"); }
+
+FString UEntityManager::GetDebugInformation() const {
+    FString Information = FString::Printf(
+        TEXT("Live: %d (Peak %d)\nRegistered: %d\nUnregistered: %d\nPending: %d"),
+        Stats.All.Live,
+        Stats.All.HighWater,
+        Stats.TotalRegistered,
+        Stats.TotalUnregistered,
+        PendingOperations.Num());
+
+    const UEnum* FactionEnum = StaticEnum<EFaction>();
+    for (const TPair<EFaction, FEntityBucketCount>& Pair : Stats.ByFaction) {
+        Information += FString::Printf(
+            TEXT("\n%s: %d (Peak %d)"),
+            FactionEnum
+                ? *FactionEnum->GetNameStringByValue(static_cast<int64>(Pair.Key))
+                : TEXT("Unknown"),
+            Pair.Value.Live,
+            Pair.Value.HighWater);
+    }
+
+    for (const TPair<FName, TSharedPtr<FEntityArchetypeBase>>& Pair : Archetypes) {
+        Information += FString::Printf(TEXT("\nArchetype %s: %d rows in %d chunks"),
+                                       *Pair.Key.ToString(),
+                                       Pair.Value->Num(),
+                                       Pair.Value->NumChunks());
+    }
+
+    return Information;
+}
+
+SIZE_T UEntityManager::GetAllocatedSize() const {
+    SIZE_T Size = Slots.GetAllocatedSize() + PendingOperations.GetAllocatedSize()
+                  + PendingRemovalRecords.GetAllocatedSize() + ChangeJournal.GetAllocatedSize()
+                  + ChangeSubscriptions.GetAllocatedSize() + HotData.GetAllocatedSize()
+                  + SpatialHash.GetAllocatedSize() + AllEntities.GetAllocatedSize();
+
+    for (const TMap<EFaction, FEntityArray>::ElementType& Pair : FactionMap) {
+        Size += Pair.Value.GetAllocatedSize();
+    }
+    for (const TMap<EEntityType, FEntityArray>::ElementType& Pair : TypeMap) {
+        Size += Pair.Value.GetAllocatedSize();
+    }
+    for (const TMap<FFactionTypeKey, FEntityArray>::ElementType& Pair : FactionAndTypeMap) {
+        Size += Pair.Value.GetAllocatedSize();
+    }
+    Size += FactionMap.GetAllocatedSize() + TypeMap.GetAllocatedSize()
+            + FactionAndTypeMap.GetAllocatedSize();
+
+    // Snapshots share nothing with the live hot data
+    for (const TSharedPtr<FEntityRegistrySnapshot, ESPMode::ThreadSafe>& Snapshot :
+         SnapshotBuffers) {
+        if (Snapshot.IsValid()) {
+            Size += sizeof(FEntityRegistrySnapshot) + Snapshot->Data.GetAllocatedSize();
+        }
+    }
+    return Size;
+}
+
+FEntityRegistrySnapshotPtr UEntityManager::GetSnapshot() const {
+    check(IsInGameThread());
+    if (bSnapshotDirty) { PublishSnapshot(); }
+    return SnapshotBuffers[PublishedSnapshotIndex];
+}
+
+void UEntityManager::PublishSnapshot() const {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_EntityManager_PublishSnapshot);
+
+    const int32 BackIndex = 1 - PublishedSnapshotIndex;
+    TSharedPtr<FEntityRegistrySnapshot, ESPMode::ThreadSafe>& BackBuffer =
+        SnapshotBuffers[BackIndex];
+    if (!BackBuffer.IsValid() || !BackBuffer.IsUnique()) {
+        BackBuffer = MakeShared<FEntityRegistrySnapshot, ESPMode::ThreadSafe>();
+    }
+
+    BackBuffer->FrameNumber = ++SnapshotFrameCounter;
+    BackBuffer->Data = HotData;
+    PublishedSnapshotIndex = BackIndex;
+    bSnapshotDirty = false;
+}
+
+int32 UEntityManager::GetHotIndex(const FEntityHandle& Handle) const {
+    const FEntitySlot* Slot = FindSlot(Handle);
+    return Slot ? Slot->AllEntitiesIndex : INDEX_NONE;
+}
+
+void UEntityManager::SetEntityTargetable(const FEntityHandle& Handle, const bool bTargetable) {
+    const int32 HotIndex = GetHotIndex(Handle);
+    if (HotIndex == INDEX_NONE) { return; }
+
+    if (HotData.Targetable[HotIndex] == bTargetable) { return; }
+
+    HotData.Targetable[HotIndex] = bTargetable;
+    RecordChange(EEntityChangeType::TargetabilityChanged, Handle.GetIndex());
+}
+
+void UEntityManager::SetEntityHealth(const FEntityHandle& Handle, const float Health) {
+    const int32 HotIndex = GetHotIndex(Handle);
+    if (HotIndex == INDEX_NONE) { return; }
+
+    HotData.Health[HotIndex] = Health;
+}
+
+void UEntityManager::RefreshEntityBuckets(const FEntityHandle& Handle) {
+    if (!FindSlot(Handle)) { return; }
+
+    const int32 SlotIndex = Handle.GetIndex();
+    FEntitySlot& Slot = Slots[SlotIndex];
+    const EFaction PreviousFaction = Slot.Faction;
+    const EEntityType PreviousType = Slot.Type;
+    const EFaction NewFaction = Slot.Entity->GetFaction();
+    const EEntityType NewType = Slot.Entity->GetEntityType();
+    if (NewFaction == PreviousFaction && NewType == PreviousType) { return; }
+
+    ++MutationSerial;
+
+    if (NewFaction != PreviousFaction) {
+        RemoveFromBucket(FactionMap.FindChecked(PreviousFaction),
+                         Slot.FactionIndex,
+                         &FEntitySlot::FactionIndex);
+        Slot.FactionIndex = AddToBucket(FactionMap.FindOrAdd(NewFaction), SlotIndex);
+    }
+    if (NewType != PreviousType) {
+        RemoveFromBucket(TypeMap.FindChecked(PreviousType), Slot.TypeIndex, &FEntitySlot::TypeIndex);
+        Slot.TypeIndex = AddToBucket(TypeMap.FindOrAdd(NewType), SlotIndex);
+    }
+    RemoveFromBucket(FactionAndTypeMap.FindChecked(FFactionTypeKey(PreviousFaction, PreviousType)),
+                     Slot.FactionAndTypeIndex,
+                     &FEntitySlot::FactionAndTypeIndex);
+    Slot.FactionAndTypeIndex = AddToBucket(
+        FactionAndTypeMap.FindOrAdd(FFactionTypeKey(NewFaction, NewType)),
+        SlotIndex);
+
+    Stats.RemoveFromBuckets(PreviousFaction, PreviousType);
+    Stats.AddToBuckets(NewFaction, NewType);
+
+    Slot.Faction = NewFaction;
+    Slot.Type = NewType;
+    HotData.Factions[Slot.AllEntitiesIndex] = NewFaction;
+    HotData.Types[Slot.AllEntitiesIndex] = NewType;
+
+    FEntityChangeRecord& Record = RecordChange(EEntityChangeType::MovedBucket, SlotIndex);
+    Record.PreviousFaction = PreviousFaction;
+    Record.PreviousType = PreviousType;
+}
+
+int32 UEntityManager::AllocateSlot() {
+    if (FirstFreeSlot != INDEX_NONE) {
+        const int32 SlotIndex = FirstFreeSlot;
+        FirstFreeSlot = Slots[SlotIndex].NextFreeSlot;
+        Slots[SlotIndex].NextFreeSlot = INDEX_NONE;
+        return SlotIndex;
+    }
+
+    if (static_cast<uint32>(Slots.Num()) > FEntityHandle::MaxIndex) { return INDEX_NONE; }
+    return Slots.AddDefaulted();
+}
+
+void UEntityManager::ReleaseSlot(const int32 SlotIndex) {
+    FEntitySlot& Slot = Slots[SlotIndex];
+    Slot.Entity = nullptr;
+    Slot.bOccupied = false;
+    Slot.AllEntitiesIndex = INDEX_NONE;
+    Slot.FactionIndex = INDEX_NONE;
+    Slot.TypeIndex = INDEX_NONE;
+    Slot.FactionAndTypeIndex = INDEX_NONE;
+
+    // Skip generation zero on wrap-around so released handles never collide with null
+    Slot.Generation = (Slot.Generation + 1) & FEntityHandle::GenerationMask;
+    if (Slot.Generation == 0) { Slot.Generation = 1; }
+
+    Slot.NextFreeSlot = FirstFreeSlot;
+    FirstFreeSlot = SlotIndex;
+}
+
+const FEntitySlot* UEntityManager::FindSlot(const FEntityHandle& Handle) const {
+    // Entities still awaiting a queued unregistration may already be pending destruction
+    const FEntitySlot* Slot = FindOccupiedSlot(Handle);
+    return Slot && IsValid(Slot->Entity.GetObject()) ? Slot : nullptr;
+}
+
+const FEntitySlot* UEntityManager::FindOccupiedSlot(const FEntityHandle& Handle) const {
+    if (!Handle.IsValid()) { return nullptr; }
+
+    const int32 SlotIndex = Handle.GetIndex();
+    if (!Slots.IsValidIndex(SlotIndex)) { return nullptr; }
+
+    const FEntitySlot& Slot = Slots[SlotIndex];
+    if (Slot.Generation != Handle.GetGeneration() || !Slot.bOccupied) { return nullptr; }
+    return &Slot;
+}
+
+int32 UEntityManager::AddToBucket(FEntityArray& Bucket, const int32 SlotIndex) const {
+    Bucket.SlotIndices.Add(SlotIndex);
+    return Bucket.Entities.Add(Slots[SlotIndex].Entity);
+}
+
+void UEntityManager::RemoveFromBucket(FEntityArray& Bucket,
+                                      const int32 BucketIndex,
+                                      int32 FEntitySlot::* SlotBucketIndex) {
+    check(Bucket.Entities.IsValidIndex(BucketIndex));
+
+    Bucket.Entities.RemoveAtSwap(BucketIndex, 1, EAllowShrinking::No);
+    Bucket.SlotIndices.RemoveAtSwap(BucketIndex, 1, EAllowShrinking::No);
+
+    // The previous last entry now lives at BucketIndex - point its slot at the new position
+    if (Bucket.SlotIndices.IsValidIndex(BucketIndex)) {
+        Slots[Bucket.SlotIndices[BucketIndex]].*SlotBucketIndex = BucketIndex;
+    }
+}
+
+bool UEntityManager::AreBucketIndicesConsistentForTesting() const {
+    const auto IsBucketConsistent = [this](const FEntityArray& Bucket,
+                                           int32 FEntitySlot::* SlotBucketIndex) {
+        if (Bucket.Entities.Num() != Bucket.SlotIndices.Num()) { return false; }
+
+        for (int32 BucketIndex = 0; BucketIndex < Bucket.SlotIndices.Num(); ++BucketIndex) {
+            const int32 SlotIndex = Bucket.SlotIndices[BucketIndex];
+            if (!Slots.IsValidIndex(SlotIndex)) { return false; }
+
+            const FEntitySlot& Slot = Slots[SlotIndex];
+            if (!Slot.bOccupied || Slot.*SlotBucketIndex != BucketIndex
+                || Slot.Entity.GetObject() != Bucket.Entities[BucketIndex].GetObject()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (!IsBucketConsistent(AllEntities, &FEntitySlot::AllEntitiesIndex)) { return false; }
+    for (const TPair<EFaction, FEntityArray>& Pair : FactionMap) {
+        if (!IsBucketConsistent(Pair.Value, &FEntitySlot::FactionIndex)) { return false; }
+    }
+    for (const TPair<EEntityType, FEntityArray>& Pair : TypeMap) {
+        if (!IsBucketConsistent(Pair.Value, &FEntitySlot::TypeIndex)) { return false; }
+    }
+    for (const TPair<FFactionTypeKey, FEntityArray>& Pair : FactionAndTypeMap) {
+        if (!IsBucketConsistent(Pair.Value, &FEntitySlot::FactionAndTypeIndex)) { return false; }
+    }
+
+    // Every occupied slot is listed once, and its hot data row sits at the same position
+    int32 NumOccupied = 0;
+    for (const FEntitySlot& Slot : Slots) { NumOccupied += Slot.bOccupied ? 1 : 0; }
+    if (NumOccupied != AllEntities.SlotIndices.Num()
+        || HotData.Handles.Num() != AllEntities.SlotIndices.Num()) { return false; }
+
+    for (int32 HotIndex = 0; HotIndex < HotData.Handles.Num(); ++HotIndex) {
+        if (HotData.Handles[HotIndex] != MakeHandle(AllEntities.SlotIndices[HotIndex])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+FEntityView UEntityManager::MakeView(const FEntityArray* Bucket) const {
+    if (!Bucket) { return FEntityView(); }
+    return FEntityView(Bucket->Entities, MutationSerial);
+}
+
+void UEntityManager::StartSpatialTracking(const int32 SlotIndex) {
+    FEntitySlot& Slot = Slots[SlotIndex];
+    const AActor* Actor = Slot.Entity->GetActor();
+    if (!Actor) { return; }
+
+    SpatialHash.Insert(SlotIndex, Actor->GetActorLocation());
+
+    // Static entities never broadcast transform updates, so binding them costs nothing
+    if (USceneComponent* RootComponent = Actor->GetRootComponent()) {
+        Slot.TrackedComponent = RootComponent;
+        Slot.TransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(
+            this,
+            &UEntityManager::OnTrackedComponentMoved,
+            SlotIndex);
+    }
+}
+
+void UEntityManager::StopSpatialTracking(const int32 SlotIndex) {
+    FEntitySlot& Slot = Slots[SlotIndex];
+    if (USceneComponent* TrackedComponent = Slot.TrackedComponent.Get()) {
+        TrackedComponent->TransformUpdated.Remove(Slot.TransformUpdatedHandle);
+    }
+    Slot.TrackedComponent.Reset();
+    Slot.TransformUpdatedHandle.Reset();
+
+    SpatialHash.Remove(SlotIndex);
+}
+
+void UEntityManager::OnTrackedComponentMoved(USceneComponent* Component,
+                                             EUpdateTransformFlags UpdateTransformFlags,
+                                             ETeleportType Teleport,
+                                             const int32 SlotIndex) {
+    const FVector Location = Component->GetComponentLocation();
+    HotData.Positions[Slots[SlotIndex].AllEntitiesIndex] = Location;
+    SpatialHash.Update(SlotIndex, Location);
+}
+
+bool UEntityManager::IsSlotLive(const int32 SlotIndex) const {
+    return IsValid(Slots[SlotIndex].Entity.GetObject());
+}
+
+bool UEntityManager::SlotMatches(const int32 SlotIndex, const FEntityQueryFilter& Filter) const {
+    if (!IsSlotLive(SlotIndex)) { return false; }
+
+    return HotData.Matches(Slots[SlotIndex].AllEntitiesIndex, Filter);
+}
+
+FEntityHandle UEntityManager::MakeHandle(const int32 SlotIndex) const {
+    return FEntityHandle(SlotIndex, Slots[SlotIndex].Generation);
+}
+
+FEntityChangeRecord& UEntityManager::RecordChange(const EEntityChangeType ChangeType,
+                                                  const int32 SlotIndex) {
+    const FEntitySlot& Slot = Slots[SlotIndex];
+
+    FEntityChangeRecord& Record = ChangeJournal.AddDefaulted_GetRef();
+    Record.ChangeType = ChangeType;
+    Record.Handle = MakeHandle(SlotIndex);
+    Record.Faction = Slot.Faction;
+    Record.Type = Slot.Type;
+    Record.PreviousFaction = Slot.Faction;
+    Record.PreviousType = Slot.Type;
+    Record.bTargetable = HotData.Targetable.IsValidIndex(Slot.AllEntitiesIndex)
+                         && HotData.Targetable[Slot.AllEntitiesIndex];
+    return Record;
+}
@@ -0,0 +1,26 @@
+#include "Entities/EntityRegistrySnapshot.h"
+
+FEntityHandle FEntityRegistrySnapshot::FindNearest(const FEntityQueryFilter& Filter,
+                                                   const FVector& Center,
+                                                   const float MaxRadius) const {
+    FEntityHandle Nearest;
+    float NearestDistanceSquared = MaxRadius * MaxRadius;
+
+    for (int32 Index = 0; Index < Data.Num(); ++Index) {
+        const float DistanceSquared = FVector::DistSquared(Data.Positions[Index], Center);
+        if (DistanceSquared <= NearestDistanceSquared && Data.Matches(Index, Filter)) {
+            NearestDistanceSquared = DistanceSquared;
+            Nearest = Data.Handles[Index];
+        }
+    }
+
+    return Nearest;
+}
+
+int32 FEntityRegistrySnapshot::Count(const FEntityQueryFilter& Filter) const {
+    int32 MatchCount = 0;
+    for (int32 Index = 0; Index < Data.Num(); ++Index) {
+        if (Data.Matches(Index, Filter)) { ++MatchCount; }
+    }
+    return MatchCount;
+}
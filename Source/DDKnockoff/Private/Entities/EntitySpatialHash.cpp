@@ -0,0 +1,116 @@
+#include "Entities/EntitySpatialHash.h"
+
+FEntitySpatialHash::FEntitySpatialHash(const float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f)), InvCellSize(1.0f / CellSize) {}
+
+void FEntitySpatialHash::Insert(const int32 Id, const FVector& Position) {
+    check(Id >= 0);
+    if (Id >= Entries.Num()) { Entries.SetNum(Id + 1); }
+    check(Entries[Id].IndexInCell == INDEX_NONE);
+
+    Entries[Id].Position = Position;
+    AddToCell(Id, GetCellFor(Position));
+}
+
+void FEntitySpatialHash::Update(const int32 Id, const FVector& Position) {
+    if (!Contains(Id)) { return; }
+
+    FEntry& Entry = Entries[Id];
+    Entry.Position = Position;
+
+    const FIntPoint NewCell = GetCellFor(Position);
+    if (NewCell == Entry.Cell) { return; }
+
+    RemoveFromCell(Id);
+    AddToCell(Id, NewCell);
+}
+
+void FEntitySpatialHash::Remove(const int32 Id) {
+    if (!Contains(Id)) { return; }
+    RemoveFromCell(Id);
+}
+
+void FEntitySpatialHash::Reset() {
+    Cells.Reset();
+    Entries.Reset();
+    MinCell = FIntPoint(MAX_int32, MAX_int32);
+    MaxCell = FIntPoint(MIN_int32, MIN_int32);
+    bBoundsDirty = false;
+}
+
+SIZE_T FEntitySpatialHash::GetAllocatedSize() const {
+    SIZE_T Size = Cells.GetAllocatedSize() + Entries.GetAllocatedSize();
+    for (const TPair<FIntPoint, TArray<int32>>& Cell : Cells) {
+        Size += Cell.Value.GetAllocatedSize();
+    }
+    return Size;
+}
+
+FIntPoint FEntitySpatialHash::GetCellFor(const FVector& Position) const {
+    return FIntPoint(FMath::FloorToInt(Position.X * InvCellSize),
+                     FMath::FloorToInt(Position.Y * InvCellSize));
+}
+
+void FEntitySpatialHash::GetOccupiedCellRange(const FVector& Center,
+                                              const float HalfExtent,
+                                              FIntPoint& OutMinCell,
+                                              FIntPoint& OutMaxCell) const {
+    // Clamp in floating point first, the unclamped cell of a huge extent does not fit an int32
+    auto ToCell = [this](const double Coordinate, const int32 Min, const int32 Max) {
+        return FMath::FloorToInt(FMath::Clamp(Coordinate * InvCellSize,
+                                              static_cast<double>(Min),
+                                              static_cast<double>(Max)));
+    };
+
+    OutMinCell = FIntPoint(ToCell(Center.X - HalfExtent, MinCell.X, MaxCell.X),
+                           ToCell(Center.Y - HalfExtent, MinCell.Y, MaxCell.Y));
+    OutMaxCell = FIntPoint(ToCell(Center.X + HalfExtent, MinCell.X, MaxCell.X),
+                           ToCell(Center.Y + HalfExtent, MinCell.Y, MaxCell.Y));
+}
+
+void FEntitySpatialHash::ShrinkBounds() {
+    if (!bBoundsDirty) { return; }
+    bBoundsDirty = false;
+
+    MinCell = FIntPoint(MAX_int32, MAX_int32);
+    MaxCell = FIntPoint(MIN_int32, MIN_int32);
+    for (const TPair<FIntPoint, TArray<int32>>& Cell : Cells) {
+        MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.Key.X), FMath::Min(MinCell.Y, Cell.Key.Y));
+        MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.Key.X), FMath::Max(MaxCell.Y, Cell.Key.Y));
+    }
+}
+
+void FEntitySpatialHash::AddToCell(const int32 Id, const FIntPoint& Cell) {
+    TArray<int32>& CellEntries = Cells.FindOrAdd(Cell);
+
+    FEntry& Entry = Entries[Id];
+    Entry.Cell = Cell;
+    Entry.IndexInCell = CellEntries.Add(Id);
+
+    MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+    MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+}
+
+void FEntitySpatialHash::RemoveFromCell(const int32 Id) {
+    FEntry& Entry = Entries[Id];
+    TArray<int32>& CellEntries = Cells.FindChecked(Entry.Cell);
+
+    // Swap-remove and patch the entry that moved into the gap
+    const int32 IndexInCell = Entry.IndexInCell;
+    CellEntries.RemoveAtSwap(IndexInCell, 1, EAllowShrinking::No);
+    if (CellEntries.IsValidIndex(IndexInCell)) {
+        Entries[CellEntries[IndexInCell]].IndexInCell = IndexInCell;
+    }
+
+    Entry.IndexInCell = INDEX_NONE;
+    if (!CellEntries.IsEmpty()) { return; }
+
+    // Drop empty cells so the map only covers where entities are now. Only a cell on the edge of
+    // the bounds can shrink them, and that waits for the next ShrinkBounds
+    const FIntPoint Cell = Entry.Cell;
+    Cells.Remove(Cell);
+    if (Cell.X == MinCell.X || Cell.X == MaxCell.X || Cell.Y == MinCell.Y
+        || Cell.Y == MaxCell.Y) {
+        bBoundsDirty = true;
+    }
+}
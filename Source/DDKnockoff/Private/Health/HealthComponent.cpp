@@ -3,6 +3,9 @@
 #include "Health/HealthBarWidget.h"
 #include "Health/HealthBarWidgetComponent.h"
 #include "Core/DDKnockoffGameSettings.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Entities/Entity.h"
+#include "Entities/EntityManager.h"
 #include "UObject/ConstructorHelpers.h"
 
 
@@ -53,6 +56,7 @@ void UHealthComponent::TakeDamage(float Amount) {
 
     CurrentHealth = FMath::Clamp(CurrentHealth - Amount, 0.0f, MaxHealth);
     UpdateHealthBarFillAmount();
+    PublishHealthToEntityManager();
 
     // Update health bar visibility based on current health
     UpdateHealthBarVisibility();
@@ -62,6 +66,30 @@ void UHealthComponent::TakeDamage(float Amount) {
 
 bool UHealthComponent::IsDead() const { return CurrentHealth <= 0.0f; }
 
+void UHealthComponent::ResetHealth() {
+    CurrentHealth = MaxHealth;
+    UpdateHealthBarFillAmount();
+    PublishHealthToEntityManager();
+    UpdateHealthBarVisibility();
+}
+
+#if WITH_EDITOR || UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT
+void UHealthComponent::SetCurrentHealthForTesting(const float NewHealth) {
+    CurrentHealth = FMath::Clamp(NewHealth, 0.0f, MaxHealth);
+    PublishHealthToEntityManager();
+}
+#endif
+
+void UHealthComponent::PublishHealthToEntityManager() const {
+    const IEntity* OwnerEntity = Cast<IEntity>(GetOwner());
+    const UWorld* World = GetWorld();
+    if (!OwnerEntity || !World) { return; }
+
+    if (UEntityManager* EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(World)) {
+        EntityManager->SetEntityHealth(OwnerEntity->GetEntityHandle(), CurrentHealth);
+    }
+}
+
 // Not const because making it so breaks the OnHealthChanged add dynamic call
 void UHealthComponent::UpdateHealthBarFillAmount() const {
     if (auto* HealthBarWidget = Cast<UHealthBarWidget>(HealthBarWidgetComponent->GetWidget())) {
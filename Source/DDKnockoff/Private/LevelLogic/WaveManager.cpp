@@ -1,25 +1,42 @@
 ﻿#include "LevelLogic/WaveManager.h"
 
-#include "EngineUtils.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 #include "LevelLogic/Spawner.h"
 #include "LevelLogic/LevelData.h"
 #include "LevelLogic/WaveData.h"
 #include "LevelLogic/WaveManagerSettings.h"
 #include "Debug/DebugInformationManager.h"
 #include "Core/DDKnockoffGameSettings.h"
+#include "Core/DDKnockoffStats.h"
 #include "Core/ManagerHandlerSubsystem.h"
+#include "Entities/EntityManager.h"
 
 class ADDKnockoffGameMode;
 
+namespace {
+    // Spawner collection scans every actor in the level, so spread it over frames
+    constexpr float SpawnerCollectionBudgetMs = 0.5f;
+    constexpr int32 ActorsPerCollectionStep = 256;
+}
+
 UWaveManager::UWaveManager() {
     CurrentState = EWaveState::Uninitialized;
     CountdownStartTime = 0.0;
     CountdownEndTime = 0.0;
     NextSpawnTime = 0.0;
     CurrentWaveIndex = 0;
+    SpawnerCollectionLevelIndex = 0;
+    SpawnerCollectionActorIndex = 0;
 }
 
 void UWaveManager::Deinitialize() {
+    // The collection job calls back into this manager, so stop it first
+    if (UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld())) {
+        Handler->CancelJob(SpawnerCollectionJob);
+    }
+    SpawnerCollectionJob = FManagerJobHandle();
+
     // Unregister as a debug information provider
     if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
         UDebugInformationManager>(GetWorld())) {
@@ -28,11 +45,18 @@ void UWaveManager::Deinitialize() {
 }
 
 void UWaveManager::Initialize() {
+    // Start from the first wave, also when reinitialized by a level reset
+    CurrentState = EWaveState::Uninitialized;
+    CurrentWaveIndex = 0;
+    CurrentActiveSpawners.Empty();
+    CountdownStartTime = 0.0;
+    CountdownEndTime = 0.0;
+    NextSpawnTime = 0.0;
+
     // Load settings from data asset
     LoadSettings();
 
-    // TODO - this is going to cause an issue if the debug information manager is not initialized yet. We would need to create a dependency system to handle this most likely.
-    // Unregister as a debug information provider
+    // Register as a debug information provider
     if (UDebugInformationManager* DebugSubsystem = UManagerHandlerSubsystem::GetManager<
         UDebugInformationManager>(GetWorld())) {
         DebugSubsystem->RegisterDebugInformationProvider(this);
@@ -48,6 +72,30 @@ void UWaveManager::Initialize() {
     CollectSpawners();
 }
 
+void UWaveManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UDebugInformationManager::StaticClass());
+    OutDependencies.Add(UEntityManager::StaticClass());
+}
+
+void UWaveManager::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const {
+    // Level data is a hard reference, so it streams in with the settings
+    if (const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get()) {
+        OutAssets.Add(GameSettings->WaveManagerSettingsAsset);
+    }
+}
+
+SIZE_T UWaveManager::GetAllocatedSize() const {
+    SIZE_T Size = CurrentActiveSpawners.GetAllocatedSize() + SpawnerMap.GetAllocatedSize()
+                  + WaveCache.GetAllocatedSize();
+    for (const FWaveSpawnCache& Cache : WaveCache) {
+        Size += Cache.SpawnerQueues.GetAllocatedSize() + Cache.ActiveSpawnerIds.GetAllocatedSize();
+        for (const TPair<int32, TArray<TSubclassOf<AActor>>>& Queue : Cache.SpawnerQueues) {
+            Size += Queue.Value.GetAllocatedSize();
+        }
+    }
+    return Size;
+}
+
 void UWaveManager::LoadSettings() {
     // Load settings path from game settings
     const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get();
@@ -56,6 +104,7 @@ void UWaveManager::LoadSettings() {
             UWaveManagerSettings>(GameSettings->WaveManagerSettingsAsset);
 
         if (SettingsAsset.IsValid() || SettingsAsset.IsPending()) {
+            // Resident already when preloaded, otherwise this falls back to a blocking load
             Settings = SettingsAsset.LoadSynchronous();
             if (Settings) {
                 Settings->ValidateConfiguration();
@@ -121,6 +170,9 @@ void UWaveManager::InitializeActiveSpawners() {
 }
 
 void UWaveManager::StartNextWave() {
+    // A wave needs every spawner, so finish collecting them now rather than waiting for the budget
+    FinishCollectingSpawners();
+
     if (CurrentState != EWaveState::WaitingToStart) { return; }
 
     if (!WaveCache.IsValidIndex(CurrentWaveIndex)) {
@@ -133,7 +185,7 @@ void UWaveManager::StartNextWave() {
     InitializeActiveSpawners();
 
     // Set countdown timestamps
-    CountdownStartTime = FPlatformTime::Seconds();
+    CountdownStartTime = GetWaveTime();
     CountdownEndTime = CountdownStartTime + Settings->WaveCountdownDuration;
     SetWaveState(EWaveState::Countdown);
 }
@@ -141,14 +193,14 @@ void UWaveManager::StartNextWave() {
 float UWaveManager::GetCountdownTime() const {
     if (CurrentState != EWaveState::Countdown) { return 0.0f; }
 
-    const double CurrentTime = FPlatformTime::Seconds();
+    const double CurrentTime = GetWaveTime();
     const double RemainingTime = CountdownEndTime - CurrentTime;
     return FMath::Max(0.0f, static_cast<float>(RemainingTime));
 }
 
 void UWaveManager::Tick(float DeltaTime) {
     if (CurrentState == EWaveState::Countdown) {
-        const double CurrentTime = FPlatformTime::Seconds();
+        const double CurrentTime = GetWaveTime();
         if (CurrentTime >= CountdownEndTime) {
             NextSpawnTime = CurrentTime;
             SetWaveState(EWaveState::Spawning);
@@ -165,15 +217,18 @@ FString UWaveManager::GetDebugInformation() const {
         StateString = EnumPtr->GetNameStringByValue(static_cast<int32>(CurrentState));
     } else { StateString = TEXT("Unknown"); }
 
-    // Number of enemies remaining in current wave
+    // Enemies remaining is every live enemy plus whatever the current wave has yet to spawn
     int32 EnemiesRemaining = 0;
-    if (Settings->LevelData && Settings->LevelData->Waves.IsValidIndex(CurrentWaveIndex)) {
-        for (const FWaveData& CurrentWave = Settings->LevelData->Waves[CurrentWaveIndex]; const
-             FSpawnerWaveData& SpawnerData : CurrentWave.SpawnerEntries) {
-            for (const FEnemySpawnData& EnemyData : SpawnerData.Enemies) {
-                EnemiesRemaining += EnemyData.Count;
-            }
-        }
+    if (const UEntityManager* EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(
+        GetWorld())) {
+        EnemiesRemaining = EntityManager->GetStats().GetFactionAndTypeCount(
+            EFaction::Enemy,
+            EEntityType::Character).Live;
+    }
+    if ((CurrentState == EWaveState::Countdown || CurrentState == EWaveState::Spawning)
+        && WaveCache.IsValidIndex(CurrentWaveIndex)) {
+        for (const TPair<int32, TArray<TSubclassOf<AActor>>>& SpawnerQueue : WaveCache[
+                 CurrentWaveIndex].SpawnerQueues) { EnemiesRemaining += SpawnerQueue.Value.Num(); }
     }
 
     // Number of enemies remaining string
@@ -181,7 +236,7 @@ FString UWaveManager::GetDebugInformation() const {
 
     // Calculate time remaining based on current state
     FString TimeRemainingString;
-    const double CurrentTime = FPlatformTime::Seconds();
+    const double CurrentTime = GetWaveTime();
 
     switch (CurrentState) {
         case EWaveState::Countdown:
@@ -204,8 +259,13 @@ FString UWaveManager::GetDebugInformation() const {
 }
 
 
+double UWaveManager::GetWaveTime() const {
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
 void UWaveManager::ProcessSpawning() {
-    const double CurrentTime = FPlatformTime::Seconds();
+    const double CurrentTime = GetWaveTime();
     if (CurrentTime < NextSpawnTime) { return; }
 
     if (SpawnWaveEnemies()) { NextSpawnTime = CurrentTime + Settings->TimeBetweenSpawns; } else {
@@ -259,6 +319,8 @@ void UWaveManager::RemoveInactiveSpawners(const TArray<int32>& SpawnersToRemove)
 bool UWaveManager::SpawnWaveEnemies() {
     if (!CanSpawnEnemies()) { return false; }
 
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_WaveManager_SpawnWaveEnemies);
+
     bool AnythingSpawned = false;
     TArray<int32> SpawnersToRemove;
 
@@ -304,22 +366,74 @@ void UWaveManager::SetWaveState(EWaveState NewState) {
 }
 
 void UWaveManager::CollectSpawners() {
-    // Clear existing spawners
+    UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld());
+    if (Handler) { Handler->CancelJob(SpawnerCollectionJob); }
+    SpawnerCollectionJob = FManagerJobHandle();
+
+    // Clear existing spawners and restart the scan from the first level
     SpawnerMap.Empty();
+    SpawnerCollectionLevelIndex = 0;
+    SpawnerCollectionActorIndex = 0;
+
+    if (!Handler) {
+        while (CollectSpawnersStep() == EManagerJobStatus::Continue) {}
+        return;
+    }
+
+    SpawnerCollectionJob = Handler->SubmitJob(TEXT("CollectSpawners"),
+                                              SpawnerCollectionBudgetMs,
+                                              [this] { return CollectSpawnersStep(); },
+                                              this);
+}
 
-    // Search the world for all actors of type ASpawner
-    for (TActorIterator<ASpawner> It(GetWorld()); It; ++It) {
-        if (ASpawner* Spawner = *It) {
-            SpawnerMap.Add(Spawner->SpawnerID, Spawner);
-            UE_LOG(LogTemp, Log, TEXT("Collected Spawner with ID: %d"), Spawner->SpawnerID);
+bool UWaveManager::IsCollectingSpawners() const {
+    const UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld());
+    return Handler && Handler->IsJobPending(SpawnerCollectionJob);
+}
+
+EManagerJobStatus UWaveManager::CollectSpawnersStep() {
+    DDKNOCKOFF_SCOPE_CYCLE_COUNTER(STAT_WaveManager_CollectSpawners);
+
+    const UWorld* World = GetWorld();
+    if (!World) { return EManagerJobStatus::Complete; }
+
+    // Indices are re-checked every step since levels and actors can change between frames
+    const TArray<ULevel*>& Levels = World->GetLevels();
+    int32 ActorsVisited = 0;
+    while (Levels.IsValidIndex(SpawnerCollectionLevelIndex)) {
+        const ULevel* Level = Levels[SpawnerCollectionLevelIndex];
+        if (Level && Level->bIsVisible) {
+            while (Level->Actors.IsValidIndex(SpawnerCollectionActorIndex)) {
+                if (ActorsVisited++ == ActorsPerCollectionStep) {
+                    return EManagerJobStatus::Continue;
+                }
+
+                ASpawner* Spawner = Cast<ASpawner>(Level->Actors[SpawnerCollectionActorIndex++]);
+                if (IsValid(Spawner)) {
+                    SpawnerMap.Add(Spawner->SpawnerID, Spawner);
+                    UE_LOG(LogTemp, Log, TEXT("Collected Spawner with ID: %d"), Spawner->SpawnerID);
+                }
+            }
         }
+
+        ++SpawnerCollectionLevelIndex;
+        SpawnerCollectionActorIndex = 0;
     }
 
     // If we have spawners, transition to WaitingToStart state
     if (SpawnerMap.Num() > 0) { SetWaveState(EWaveState::WaitingToStart); }
+    return EManagerJobStatus::Complete;
+}
+
+void UWaveManager::FinishCollectingSpawners() {
+    if (UManagerHandlerSubsystem* Handler = UManagerHandlerSubsystem::Get(GetWorld())) {
+        Handler->CompleteJob(SpawnerCollectionJob);
+    }
 }
 
 void UWaveManager::CloseDoors() {
+    FinishCollectingSpawners();
+
     // Close the door for every spawner in the spawner map
     for (const auto KVPair : SpawnerMap) { KVPair.Value->CloseDoors(); }
 }
@@ -385,6 +385,7 @@ void ADDKnockoffCharacter::OnCapsuleOverlapBegin(UPrimitiveComponent* Overlapped
 void ADDKnockoffCharacter::BeginPlay() {
     Super::BeginPlay();
     CachedPlayerController = Cast<APlayerController>(GetController());
+    StartTransform = GetActorTransform();
 
     // Handle dependency injection with single call
     EnsureDependenciesInjected();
@@ -604,6 +605,9 @@ void ADDKnockoffCharacter::UpdatePreviewColor() const {
 
 void ADDKnockoffCharacter::StartPlacingStructure(
     const TSubclassOf<ADefensiveStructure>& StructureClass) {
+    // Placement settings may still be streaming in at level start
+    if (!PlacementSubsystem || !PlacementSubsystem->AreSettingsLoaded()) { return; }
+
     if (StructurePreview != NULL) { StructurePreview->Destroy(); }
 
     // Spawn the structure in front of the character
@@ -1042,3 +1046,19 @@ EFaction ADDKnockoffCharacter::GetFaction() const { return EFaction::Player; }
 AActor* ADDKnockoffCharacter::GetActor() { return this; }
 EEntityType ADDKnockoffCharacter::GetEntityType() const { return EEntityType::Character; }
 UEntityData* ADDKnockoffCharacter::GetEntityData() const { return EntityData; }
+
+void ADDKnockoffCharacter::ResetEntity() {
+    CancelStructurePlacement();
+
+    CurrentCurrency = 0;
+    bComboInputBuffered = false;
+    bIsPerformingAttackRotation = false;
+    GetWorldTimerManager().ClearTimer(ComboWindowTimerHandle);
+
+    // Back to the spawn point, dropping any momentum from the previous round
+    GetCharacterMovement()->StopMovementImmediately();
+    SetActorTransform(StartTransform, false, nullptr, ETeleportType::ResetPhysics);
+    if (CachedPlayerController) {
+        CachedPlayerController->SetControlRotation(StartTransform.Rotator());
+    }
+}
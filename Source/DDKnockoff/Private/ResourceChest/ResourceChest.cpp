@@ -8,6 +8,7 @@
 #include "Core/ManagerHandlerSubsystem.h"
 #include "Currency/CurrencySpawner.h"
 #include "Currency/CurrencyUtils.h"
+#include "Enemies/CrystalPathFieldManager.h"
 #include "Structures/DefensiveStructureNavArea.h"
 #include "NavAreas/NavArea_Default.h"
 
@@ -69,8 +70,8 @@ void AResourceChest::BeginPlay() {
     // Validate configuration after dependencies are set
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     AnimInstance = Cast<UResourceChestAnimInstance>(SkeletonMesh->GetAnimInstance());
     ensureAlways(AnimInstance != nullptr);
@@ -87,8 +88,8 @@ void AResourceChest::Tick(float DeltaTime) {
 }
 
 void AResourceChest::EndPlay(EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
     Super::EndPlay(EndPlayReason);
 }
 
@@ -197,6 +198,7 @@ void AResourceChest::DisableChest() const {
     SkeletonMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     // Disable the nav modifier
     NavModifierComponent->SetAreaClass(UNavArea_Default::StaticClass());
+    NotifyNavAreaChanged();
 }
 
 void AResourceChest::EnableChest() const {
@@ -206,6 +208,15 @@ void AResourceChest::EnableChest() const {
     SkeletonMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     // Enable the nav modifier
     NavModifierComponent->SetAreaClass(NavAreaClass);
+    NotifyNavAreaChanged();
+}
+
+void AResourceChest::NotifyNavAreaChanged() const {
+    // Enemies weigh crystals by the path field, which samples nav areas
+    if (UCrystalPathFieldManager* PathField = UManagerHandlerSubsystem::GetManager<
+        UCrystalPathFieldManager>(GetWorld())) {
+        PathField->MarkAreaDirty(GetComponentsBoundingBox(true));
+    }
 }
 
 void AResourceChest::ResetChest() {
@@ -219,6 +230,8 @@ void AResourceChest::ResetChest() {
     EnableChest();
 }
 
+void AResourceChest::ResetEntity() { ResetChest(); }
+
 // IDependencyInjectable interface implementation
 bool AResourceChest::HasRequiredDependencies() const { return EntityManager != nullptr; }
 
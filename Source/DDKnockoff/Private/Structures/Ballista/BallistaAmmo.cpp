@@ -88,8 +88,8 @@ void ABallistaAmmo::BeginPlay() {
     // Validate configuration after dependencies are set
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     VisualMesh->OnComponentHit.RemoveDynamic(this, &ABallistaAmmo::OnPhysicalHit);
     VisualMesh->OnComponentHit.AddDynamic(this, &ABallistaAmmo::OnPhysicalHit);
@@ -119,8 +119,8 @@ EEntityType ABallistaAmmo::GetEntityType() const { return EEntityType::Projectil
 AActor* ABallistaAmmo::GetActor() { return this; }
 
 void ABallistaAmmo::EndPlay(const EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
     Super::EndPlay(EndPlayReason);
 }
 
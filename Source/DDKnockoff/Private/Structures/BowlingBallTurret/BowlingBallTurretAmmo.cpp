@@ -56,8 +56,8 @@ void ABowlingBallTurretAmmo::BeginPlay() {
     // Validate configuration after dependencies are set
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     Mesh->OnComponentHit.RemoveDynamic(this, &ABowlingBallTurretAmmo::OnPhysicalHit);
     Mesh->OnComponentHit.AddDynamic(this, &ABowlingBallTurretAmmo::OnPhysicalHit);
@@ -83,8 +83,8 @@ EEntityType ABowlingBallTurretAmmo::GetEntityType() const { return EEntityType::
 AActor* ABowlingBallTurretAmmo::GetActor() { return this; }
 
 void ABowlingBallTurretAmmo::EndPlay(const EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
     Super::EndPlay(EndPlayReason);
 }
 
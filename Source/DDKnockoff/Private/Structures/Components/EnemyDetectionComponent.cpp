@@ -1,7 +1,8 @@
 #include "Structures/Components/EnemyDetectionComponent.h"
 
-#include "Collision/DDCollisionChannels.h"
+#include "Core/ManagerHandlerSubsystem.h"
 #include "Entities/Entity.h"
+#include "Entities/EntityManager.h"
 #include "Utils/GeometryUtils.h"
 
 UEnemyDetectionComponent::UEnemyDetectionComponent() {
@@ -17,33 +18,47 @@ void UEnemyDetectionComponent::BeginPlay() {
 
 FEnemyDetectionResult UEnemyDetectionComponent::DetectEnemies() {
     FEnemyDetectionResult Result;
-    DetectionSphere->GetOverlappingActors(ActorsInRange);
     Result.bEnemiesInRange = CheckForEnemiesInRange(Result.ClosestEnemy);
     return Result;
 }
 
-bool UEnemyDetectionComponent::CheckForEnemiesInRange(TObjectPtr<AActor>& OutClosestEnemy) const {
+bool UEnemyDetectionComponent::CheckForEnemiesInRange(TObjectPtr<AActor>& OutClosestEnemy) {
     OutClosestEnemy = nullptr;
-    float ClosestDistance = FLT_MAX;
-    bool bEnemiesInRange = false;
-    const EFaction OwnerFaction = GetOwnerFaction();
 
-    for (AActor* Actor : ActorsInRange) {
-        if (Actor == GetOwner()) { continue; }
-
-        if (const IEntity* Entity = Cast<IEntity>(Actor)) {
-            if (Entity->GetFaction() != OwnerFaction && IsActorInVisionCone(Actor)) {
-                bEnemiesInRange = true;
-                const float Distance = UGeometryUtils::GetDistanceBetweenActors(Actor, GetOwner());
-                if (Distance < ClosestDistance) {
-                    ClosestDistance = Distance;
-                    OutClosestEnemy = Actor;
-                }
-            }
-        }
+    AActor* Owner = GetOwner();
+    UEntityManager* Manager = GetEntityManager();
+    if (!Owner || !Manager) { return false; }
+
+    const EFaction OwnerFaction = GetOwnerFaction();
+    if (VisionConeAngleDegrees >= 360.0f) {
+        // Omnidirectional detection can be answered entirely from the manager's hot data
+        FEntityQueryFilter Filter;
+        Filter.ExcludedFaction = OwnerFaction;
+        Manager->FindNearest(Filter, Owner->GetActorLocation(), 1, NearestHandles, DetectionRadius);
+    } else {
+        Manager->FindNearest(
+            Owner->GetActorLocation(),
+            1,
+            [this, Owner, OwnerFaction](IEntity& Entity) {
+                AActor* Actor = Entity.GetActor();
+                return Actor != Owner && Entity.GetFaction() != OwnerFaction
+                       && IsActorInVisionCone(Actor);
+            },
+            NearestHandles,
+            DetectionRadius);
     }
 
-    return bEnemiesInRange;
+    if (NearestHandles.IsEmpty()) { return false; }
+
+    OutClosestEnemy = Manager->ResolveActor(NearestHandles[0]);
+    return OutClosestEnemy != nullptr;
+}
+
+UEntityManager* UEnemyDetectionComponent::GetEntityManager() {
+    if (!EntityManager) {
+        EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(GetWorld());
+    }
+    return EntityManager;
 }
 
 EFaction UEnemyDetectionComponent::GetOwnerFaction() const {
@@ -56,12 +71,10 @@ void UEnemyDetectionComponent::OnRegister() {
 
     DetectionSphere->SetupAttachment(GetOwner()->GetRootComponent());
     DetectionSphere->SetSphereRadius(DetectionRadius);
-    DetectionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    DetectionSphere->SetCollisionObjectType(DDCollisionChannels::ECC_Trigger);
-    DetectionSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
-    DetectionSphere->SetCollisionResponseToChannel(DDCollisionChannels::ECC_Hurtbox, ECR_Overlap);
-    DetectionSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-    DetectionSphere->SetCollisionResponseToChannel(DDCollisionChannels::ECC_EnemyPawn, ECR_Overlap);
+
+    // Detection queries the entity manager, the sphere only shows the radius in the editor
+    DetectionSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    DetectionSphere->SetGenerateOverlapEvents(false);
 }
 
 bool UEnemyDetectionComponent::IsActorInVisionCone(AActor* Actor) const {
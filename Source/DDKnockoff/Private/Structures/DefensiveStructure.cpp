@@ -111,6 +111,7 @@ UStaticMeshComponent* ADefensiveStructure::GetPreviewCollisionMesh() const {
 
 void ADefensiveStructure::OnStartedPreviewing() {
     StructurePlacementState = EStructurePlacementState::Previewing;
+    if (EntityManager) { EntityManager->SetEntityTargetable(GetEntityHandle(), false); }
 
     PhysicalCollisionMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     PreviewCollisionMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
@@ -121,6 +122,7 @@ void ADefensiveStructure::OnStartedPreviewing() {
 
 void ADefensiveStructure::OnPlaced() {
     StructurePlacementState = EStructurePlacementState::NotPreviewing;
+    if (EntityManager) { EntityManager->SetEntityTargetable(GetEntityHandle(), true); }
 
     PhysicalCollisionMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     PreviewCollisionMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -148,8 +150,8 @@ void ADefensiveStructure::BeginPlay() {
     // Validate editor-configured properties
     ValidateConfiguration();
 
-    // Register with EntityManager using injected dependency
-    EntityManager->RegisterEntity(this);
+    // Queue registration with EntityManager, committed on its next tick
+    EntityManager->QueueRegister(this);
 
     HealthComponent->OnReachedZeroHealth.RemoveDynamic(this, &ADefensiveStructure::OnDeath);
     HealthComponent->OnReachedZeroHealth.AddDynamic(this, &ADefensiveStructure::OnDeath);
@@ -159,8 +161,8 @@ void ADefensiveStructure::BeginPlay() {
 void ADefensiveStructure::Tick(float DeltaTime) { Super::Tick(DeltaTime); }
 
 void ADefensiveStructure::EndPlay(const EEndPlayReason::Type EndPlayReason) {
-    // Unregister from EntityManager using injected dependency
-    EntityManager->UnregisterEntity(this);
+    // Queue unregistration with EntityManager, committed on its next tick
+    EntityManager->QueueUnregister(this);
 
     Super::EndPlay(EndPlayReason);
 }
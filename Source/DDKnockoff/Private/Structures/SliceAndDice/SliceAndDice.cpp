@@ -93,7 +93,7 @@ void ASliceAndDice::UpdateHitboxState() {
     if (ShouldBeEnabled && HitboxState == ESliceAndDiceHitboxState::Disabled) {
         HitboxState = ESliceAndDiceHitboxState::Enabled;
         HitboxMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-        LastEnemyHitTime = FPlatformTime::Seconds();
+        LastEnemyHitTime = GetWorld()->GetTimeSeconds();
     } else if (!ShouldBeEnabled && HitboxState == ESliceAndDiceHitboxState::Enabled) {
         HitboxState = ESliceAndDiceHitboxState::Disabled;
         HitboxMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -103,7 +103,7 @@ void ASliceAndDice::UpdateHitboxState() {
 void ASliceAndDice::HandleHitDetection() {
     if (HitboxState != ESliceAndDiceHitboxState::Enabled) { return; }
 
-    const double CurrentTime = FPlatformTime::Seconds();
+    const double CurrentTime = GetWorld()->GetTimeSeconds();
     const double ScaledHitDelay = CalculateHitDelay();
 
     if (CurrentTime <= LastEnemyHitTime + ScaledHitDelay) { return; }
@@ -10,7 +10,7 @@ void UStructurePlacementManager::Initialize() {
             GameSettings->StructurePlacementSettingsAsset);
     }
 
-    // Load everything synchronously at initialization
+    // Resolve settings and material, both already resident unless preloading was skipped
     LoadPlacementSettings();
 
     // Ensure settings are valid - if not, the game is broken
@@ -22,6 +22,20 @@ void UStructurePlacementManager::Deinitialize() {
     CachedPreviewMaterial = nullptr;
 }
 
+void UStructurePlacementManager::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const {
+    const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get();
+    if (!GameSettings) { return; }
+
+    OutAssets.Add(GameSettings->StructurePlacementSettingsAsset);
+
+    // The preview material is only known once the settings asset has loaded
+    const TSoftObjectPtr<UStructurePlacementSettings> SettingsAsset(
+        GameSettings->StructurePlacementSettingsAsset);
+    if (const UStructurePlacementSettings* LoadedSettings = SettingsAsset.Get()) {
+        OutAssets.Add(LoadedSettings->PreviewMaterial.ToSoftObjectPath());
+    }
+}
+
 const UStructurePlacementSettings& UStructurePlacementManager::GetPlacementSettings() const {
     // Settings are guaranteed valid after initialization
     return *CachedSettings;
@@ -35,7 +49,7 @@ const UMaterialInterface& UStructurePlacementManager::GetPreviewMaterial() const
 void UStructurePlacementManager::LoadPlacementSettings() {
     ensureAlways(!PlacementSettingsAsset.IsNull());
 
-    // Load settings synchronously - if this fails, the game is broken
+    // Fall back to a synchronous load if not preloaded - if this fails, the game is broken
     CachedSettings = PlacementSettingsAsset.LoadSynchronous();
     ensureAlways(CachedSettings);
 
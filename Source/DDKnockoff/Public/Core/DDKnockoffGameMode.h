@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Debug/DebugInformationProvider.h"
+#include "Entities/EntityManager.h"
 #include "LevelLogic/WaveManager.h"
 #include "GameFramework/GameModeBase.h"
 #include "DDKnockoffGameMode.generated.h"
@@ -15,6 +16,7 @@ class UWaveManager;
 class ULevelData;
 class UCurrencyManagerSettings;
 class UCurrencyManager;
+class ACrystalStructure;
 
 /**
  * Game phase enumeration for tracking the overall game flow state.
@@ -32,6 +34,23 @@ enum class EGamePhase : uint8 {
     Defeat UMETA(DisplayName = "Defeat") // Defeat state before restart
 };
 
+/**
+ * Crystal present at the start of play, respawned by a level reset if it was destroyed.
+ */
+USTRUCT()
+struct FStartingCrystal {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TSubclassOf<ACrystalStructure> CrystalClass;
+
+    UPROPERTY()
+    FTransform Transform;
+
+    UPROPERTY()
+    TWeakObjectPtr<ACrystalStructure> Instance;
+};
+
 /**
  * Main game mode for DD Knockoff that manages game flow, wave progression, and manager coordination.
  * Handles phase transitions, ready-up mechanics, and entity lifecycle management.
@@ -104,6 +123,21 @@ public:
     UFUNCTION()
     void ReloadCurrentMap() const;
 
+    /**
+     * Restart after defeat or reward, in place or by reloading the map per bSoftResetOnRestart.
+     * The -DDReloadOnRestart command-line switch forces a reload, e.g. to compare soak runs.
+     */
+    UFUNCTION()
+    void RestartLevel();
+
+    /**
+     * Reset the level in place without reloading the map. Destroys everything spawned during
+     * play, respawns destroyed starting crystals, refreshes the managers and resets every
+     * surviving entity, then returns to initial preparation.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Game Flow")
+    void SoftResetLevel();
+
     // Ready-up system
 
     /**
@@ -126,6 +160,17 @@ public:
 protected:
     // Phase management internals
 
+    /**
+     * Finish setup that needs initialized managers, once their assets have streamed in.
+     */
+    void OnManagersReady();
+
+    /**
+     * Check whether the managers have finished initializing.
+     * @return true once every manager asset has resolved
+     */
+    bool AreManagersReady() const;
+
     /**
      * Internal function to handle phase transitions with proper cleanup.
      * @param NewPhase - Phase to transition to
@@ -156,6 +201,26 @@ protected:
      */
     void UpdateReadyUpProgress(float DeltaTime);
 
+    // Level reset
+
+    /**
+     * Remember every crystal placed in the level so a reset can restore them.
+     */
+    void RecordStartingCrystals();
+
+    /**
+     * Spawn a replacement for every starting crystal that has been destroyed.
+     */
+    void RestoreStartingCrystals();
+
+    /**
+     * Check whether an entity only exists because of play, e.g. enemies, built structures
+     * and projectiles, and so should be destroyed rather than reset.
+     * @param Entity - Entity to check
+     * @return true if a reset should destroy the entity
+     */
+    static bool IsSpawnedDuringPlay(const IEntity& Entity);
+
     // Entity management
 
     /**
@@ -171,17 +236,26 @@ protected:
     bool AreAllCrystalsDead() const;
 
     /**
-     * Handle entity removal events for phase transition logic.
-     * @param Entity - Entity that was removed
+     * Handle crystal removals from the entity change journal, entering defeat once none remain.
+     * Subscribed before the enemy handler so losing the last crystal takes priority.
+     * @param Changes - Crystal removal records since the previous dispatch
      */
-    UFUNCTION()
-    void OnEntityRemoved(const TScriptInterface<IEntity>& Entity);
+    void OnCrystalsRemoved(TConstArrayView<FEntityChangeRecord> Changes);
+
+    /**
+     * Handle enemy removals from the entity change journal, advancing the phase once none remain.
+     * @param Changes - Enemy character removal records since the previous dispatch
+     */
+    void OnEnemiesRemoved(TConstArrayView<FEntityChangeRecord> Changes);
 
     /**
-     * Bind to entity manager events for lifecycle tracking.
+     * Subscribe to entity manager change journal for lifecycle tracking.
      */
     void BindToEntityEvents();
 
+    FDelegateHandle CrystalsRemovedHandle;
+    FDelegateHandle EnemiesRemovedHandle;
+
     // Manager references
 
     UPROPERTY(Transient)
@@ -211,6 +285,10 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Game Flow")
     float RewardPhaseDuration = 3.0f;
 
+    /** Restart in place after defeat or reward instead of reloading the map */
+    UPROPERTY(EditAnywhere, Category = "Game Flow")
+    bool bSoftResetOnRestart = true;
+
     // Runtime state
 
     UPROPERTY(BlueprintReadOnly, Category = "Game Flow")
@@ -223,4 +301,7 @@ protected:
     bool bIsReadyingUp;
 
     FTimerHandle PhaseTransitionTimerHandle;
+
+    UPROPERTY(Transient)
+    TArray<FStartingCrystal> StartingCrystals;
 };
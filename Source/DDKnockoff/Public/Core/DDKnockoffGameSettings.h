@@ -89,4 +89,14 @@ public:
         Category = "Asset Paths",
         meta = (DisplayName = "Defense Structures Path"))
     FString DefenseStructuresPath;
+
+    // Simulation
+
+    /** Fixed delta time, in seconds, used when fast-forwarding without an engine fixed step */
+    UPROPERTY(Config,
+        EditAnywhere,
+        BlueprintReadOnly,
+        Category = "Simulation Settings",
+        meta = (DisplayName = "Simulation Time Step", ClampMin = "0.001", ClampMax = "0.25"))
+    float SimulationTimeStep = 1.0f / 30.0f;
 };
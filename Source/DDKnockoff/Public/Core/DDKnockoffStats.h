@@ -0,0 +1,159 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Stat group and trace channel for the game's own systems.
+ * Use `stat DDKnockoff` in game, or run with `-trace=cpu,ddknockoff` and open the capture in
+ * Unreal Insights. Each manager also gets a cycle and a memory stat named after its class,
+ * created by UManagerBase.
+ */
+DECLARE_STATS_GROUP(TEXT("DDKnockoff"), STATGROUP_DDKnockoff, STATCAT_Advanced);
+
+/** Scopes enabled by `-trace=ddknockoff`, on top of the engine's cpu channel */
+UE_TRACE_CHANNEL_EXTERN(DDKnockoffChannel, DDKNOCKOFF_API);
+
+// Manager handler
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Manager Tick Phase"),
+                          STAT_ManagerHandler_TickPhase,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Manager Jobs"),
+                          STAT_ManagerHandler_RunJobs,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pending Manager Jobs"),
+                                  STAT_ManagerHandler_PendingJobs,
+                                  STATGROUP_DDKnockoff,
+                                  DDKNOCKOFF_API);
+
+// Entity manager
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Register"),
+                          STAT_EntityManager_RegisterEntity,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Unregister"),
+                          STAT_EntityManager_UnregisterEntity,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Commit Pending"),
+                          STAT_EntityManager_CommitPendingOperations,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Query Radius"),
+                          STAT_EntityManager_QueryRadius,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Find Nearest"),
+                          STAT_EntityManager_FindNearest,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Publish Snapshot"),
+                          STAT_EntityManager_PublishSnapshot,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Entity Dispatch Changes"),
+                          STAT_EntityManager_DispatchChangeJournal,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Registered Entities"),
+                                  STAT_EntityManager_NumEntities,
+                                  STATGROUP_DDKnockoff,
+                                  DDKNOCKOFF_API);
+
+// Wave manager
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Wave Spawn Enemies"),
+                          STAT_WaveManager_SpawnWaveEnemies,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Wave Collect Spawners"),
+                          STAT_WaveManager_CollectSpawners,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// Currency manager
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Currency Calculate Spawn Info"),
+                          STAT_CurrencyManager_CalculateCurrencySpawnInfo,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// Debug information manager
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Debug Update Widget"),
+                          STAT_DebugInformationManager_UpdateWidget,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// AI director
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Director Gather"),
+                          STAT_AIDirector_Gather,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Director Decide"),
+                          STAT_AIDirector_Decide,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Director Apply"),
+                          STAT_AIDirector_Apply,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// Crystal path field
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crystal Field Rebuild"),
+                          STAT_CrystalPathField_Rebuild,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crystal Field Solve"),
+                          STAT_CrystalPathField_Solve,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crystal Field Sample"),
+                          STAT_CrystalPathField_Sample,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// Flow field movement
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flow Field Gather"),
+                          STAT_FlowFieldMovement_Gather,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flow Field Steer"),
+                          STAT_FlowFieldMovement_Steer,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flow Field Apply"),
+                          STAT_FlowFieldMovement_Apply,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// Path requests
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Requests Dispatch"),
+                          STAT_PathRequests_Dispatch,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+// AI significance
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Significance Evaluate"),
+                          STAT_AISignificance_Evaluate,
+                          STATGROUP_DDKnockoff,
+                          DDKNOCKOFF_API);
+
+/**
+ * Time a scope with a DDKnockoff cycle stat, and mark it on the DDKnockoff trace channel under
+ * the stat's name so it shows up in Insights without stats enabled.
+ */
+#define DDKNOCKOFF_SCOPE_CYCLE_COUNTER(Stat) \
+    SCOPE_CYCLE_COUNTER(Stat); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, DDKnockoffChannel)
@@ -2,8 +2,24 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "Templates/SubclassOf.h"
+#include "Stats/Stats.h"
 #include "ManagerBase.generated.h"
 
+/**
+ * Point in the frame at which a manager ticks.
+ */
+UENUM()
+enum class EManagerTickPhase : uint8 {
+    PrePhysics,
+    // Before physics, alongside most actor ticks
+    PostPhysics,
+    // After physics has moved everything for the frame
+    Late,
+    // After every tick group, with the other tickable objects
+    MAX UMETA(Hidden)
+};
+
 /**
  * Base class for all manager systems in the game.
  * Provides standard lifecycle functions for initialization, ticking, and cleanup.
@@ -31,4 +47,73 @@ public:
      * @param DeltaTime - Time elapsed since last tick
      */
     virtual void Tick(float DeltaTime);
+
+    // Initialization ordering
+
+    /**
+     * Declare managers that must be initialized before this one.
+     * Dependencies not present in the manager set are ignored, so optional managers can be
+     * listed freely.
+     * @param OutDependencies - Receives the manager classes this manager depends on
+     */
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const;
+
+    /**
+     * Whether Initialize may run on a worker thread alongside other managers whose
+     * dependencies are satisfied. Only opt in if Initialize touches no world, actor or
+     * UObject state shared with other managers.
+     * @return true to allow concurrent initialization
+     */
+    virtual bool SupportsConcurrentInitialize() const { return false; }
+
+    // Asset preloading
+
+    /**
+     * Declare assets to load before Initialize, so it finds them resident instead of loading
+     * them on the game thread. Called again after each preload round until no new paths come
+     * back, so assets referenced by earlier ones can be added once those have loaded.
+     * @param OutAssets - Receives the asset paths, duplicates and null paths are ignored
+     */
+    virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const;
+
+    // Ticking
+
+    /**
+     * Get the phase this manager ticks in. Within a phase managers tick in dependency order.
+     * @return Tick phase, Late by default
+     */
+    virtual EManagerTickPhase GetTickPhase() const { return EManagerTickPhase::Late; }
+
+    /**
+     * Whether Tick may run as a worker task alongside the phase's game-thread managers.
+     * Worker ticks finish before the phase ends. Only opt in if Tick touches no world, actor or
+     * UObject state, and reads nothing other managers in the same phase write.
+     * @return true to tick on a worker thread
+     */
+    virtual bool IsTickThreadSafe() const { return false; }
+
+    // Profiling
+
+    /**
+     * Report heap memory owned by this manager's containers, for its memory stat.
+     * Only called while stats are being collected, so it may walk its containers.
+     * @return Allocated bytes, not counting the manager object itself
+     */
+    virtual SIZE_T GetAllocatedSize() const { return 0; }
+
+    /** Cycle stat timing this manager's Tick, named after its class in STATGROUP_DDKnockoff */
+    TStatId GetTickStatId() const { return TickStatId; }
+
+    /** Memory stat reporting GetAllocatedSize, named after its class in STATGROUP_DDKnockoff */
+    TStatId GetMemoryStatId() const { return MemoryStatId; }
+
+    /** Class name used for this manager's trace scopes */
+    const TCHAR* GetTraceName() const { return *TraceName; }
+
+    virtual void PostInitProperties() override;
+
+private:
+    TStatId TickStatId;
+    TStatId MemoryStatId;
+    FString TraceName;
 };
@@ -1,9 +1,95 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/StreamableManager.h"
+#include "Core/ManagerBase.h"
+#include "Core/ManagerJob.h"
 #include "ManagerHandlerSubsystem.generated.h"
 
-class UManagerBase;
+class UManagerHandlerSubsystem;
+
+/**
+ * Assigns every manager class a dense slot index, shared by all modules in the process.
+ */
+struct DDKNOCKOFF_API FManagerSlotRegistry {
+    /**
+     * Get the slot index for a manager class, assigning the next free index on first request.
+     * @param ManagerClass - Manager class
+     * @return Slot index, stable for the lifetime of the process
+     */
+    static int32 GetSlot(const UClass* ManagerClass);
+};
+
+/**
+ * Compile-time accessor for a manager type's slot index.
+ * The index is resolved through the registry once per module and cached in a static, so
+ * lookups after the first are a plain load.
+ */
+template <typename T>
+struct TManagerSlot {
+    static int32 Get() {
+        static const int32 Slot = FManagerSlotRegistry::GetSlot(T::StaticClass());
+        return Slot;
+    }
+};
+
+/**
+ * How SetManagers brings in the assets managers ask to have preloaded.
+ */
+UENUM()
+enum class EManagerAssetLoading : uint8 {
+    Blocking,
+    // Load everything before SetManagers returns, managers are initialized on return
+    Streamed
+    // Stream everything in one batch per round, managers are initialized once it resolves
+};
+
+/**
+ * Timings for the most recent manager asset preload.
+ */
+USTRUCT(BlueprintType)
+struct FManagerAssetLoadStats {
+    GENERATED_BODY()
+
+    /** Assets requested across every round */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Assets")
+    int32 NumAssets = 0;
+
+    /** Batches requested - later rounds cover assets only known once earlier ones loaded */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Assets")
+    int32 NumRounds = 0;
+
+    /** Time from SetManagers until every asset resolved, in seconds */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Assets")
+    float LoadSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Assets")
+    bool bStreamed = false;
+};
+
+/**
+ * Tick function that runs one manager tick phase inside a world tick group.
+ */
+USTRUCT()
+struct FManagerPhaseTickFunction : public FTickFunction {
+    GENERATED_BODY()
+
+    UManagerHandlerSubsystem* Handler = nullptr;
+    EManagerTickPhase Phase = EManagerTickPhase::PrePhysics;
+
+    virtual void ExecuteTick(float DeltaTime,
+                             ELevelTick TickType,
+                             ENamedThreads::Type CurrentThread,
+                             const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FManagerPhaseTickFunction>
+    : public TStructOpsTypeTraitsBase2<FManagerPhaseTickFunction> {
+    enum { WithCopy = false };
+};
 
 /**
  * Central subsystem for managing and providing access to game managers.
@@ -21,34 +107,69 @@ public:
 
     // Manager access
 
+    /**
+     * Get the subsystem for a world, caching the most recently requested world.
+     * Game thread only.
+     * @param World - World to get the subsystem from
+     * @return Subsystem, or null if the world is null or has none
+     */
+    static UManagerHandlerSubsystem* Get(const UWorld* World);
+
     /**
      * Static convenience method for manager access from any world context.
      * @param World - World context to get subsystem from
      * @return Manager instance of type T or null if not found
      */
     template <typename T>
-    static T* GetManager(UWorld* World) {
-        return World->GetSubsystem<UManagerHandlerSubsystem>()->GetManager<T>();
+    static T* GetManager(const UWorld* World) {
+        UManagerHandlerSubsystem* Subsystem = Get(World);
+        return Subsystem ? Subsystem->GetManager<T>() : nullptr;
     }
 
     /**
-     * Get manager instance by template type.
+     * Get manager instance by template type. Indexes the slot table directly - no hashing or
+     * casting, since each slot only ever holds an instance of exactly its class.
      * @return Manager instance of type T or null if not found
      */
     template <typename T>
     T* GetManager() {
-        auto FoundValue = Managers.Find(T::StaticClass());
-        if (FoundValue) { return Cast<T>(*FoundValue); }
-        return nullptr;
+        static_assert(TIsDerivedFrom<T, UManagerBase>::Value, "T must be a manager");
+
+        const int32 Slot = TManagerSlot<T>::Get();
+        return ManagersBySlot.IsValidIndex(Slot) ? static_cast<T*>(ManagersBySlot[Slot]) : nullptr;
     }
 
     // Manager lifecycle
 
     /**
-     * Initialize managers from provided class list.
+     * Create managers from provided class list and initialize them in dependency order.
+     * Managers whose dependencies are satisfied at the same time and that support concurrent
+     * initialization are initialized in parallel. A dependency cycle is reported and falls
+     * back to list order.
+     * Every asset the managers ask to preload is loaded first. When streamed, managers exist
+     * but are neither initialized nor ticked until the load resolves - use CallWhenManagersReady.
      * @param ManagerClasses - Array of manager classes to instantiate and register
+     * @param AssetLoading - Whether to block on the preload or stream it
+     * @param AdditionalAssets - Extra assets to preload in the same batch, e.g. the caller's own
      */
-    void SetManagers(const TArray<UClass*>& ManagerClasses);
+    void SetManagers(const TArray<UClass*>& ManagerClasses,
+                     EManagerAssetLoading AssetLoading = EManagerAssetLoading::Blocking,
+                     const TArray<FSoftObjectPath>& AdditionalAssets = {});
+
+    /**
+     * Check whether the current managers have been initialized.
+     * @return true once the preload has resolved and every manager is initialized
+     */
+    bool AreManagersReady() const { return bManagersReady; }
+
+    /**
+     * Run a callback once the current managers are initialized, or right away if they already
+     * are. Pending callbacks are dropped if the managers are cleared first.
+     * @param Callback - Callback to run
+     */
+    void CallWhenManagersReady(FSimpleDelegate Callback);
+
+    const FManagerAssetLoadStats& GetAssetLoadStats() const { return AssetLoadStats; }
 
     /**
      * Clean up and destroy all managed instances.
@@ -56,18 +177,229 @@ public:
     void ClearManagers();
 
     /**
-     * Reinitialize all managers with current configuration.
+     * Reinitialize all managers with current configuration, in dependency order.
      */
     void RefreshManagers();
 
+    /**
+     * Get every manager in initialization order.
+     * @return Managers, dependencies before dependents
+     */
+    const TArray<UManagerBase*>& GetOrderedManagers() const { return OrderedManagers; }
+
+    /**
+     * Group managers into dependency levels using Kahn's algorithm.
+     * Each level only depends on earlier levels; order within a level follows the input order.
+     * @param InManagers - Managers to sort
+     * @param OutLevels - Receives the managers grouped by level
+     * @return false if the dependencies contain a cycle, in which case OutLevels is incomplete
+     */
+    static bool SortByDependencies(const TArray<UManagerBase*>& InManagers,
+                                   TArray<TArray<UManagerBase*>>& OutLevels);
+
+    // Tick phases
+
+    /**
+     * Tick every manager in a phase. Thread-safe managers are launched as tasks first, then
+     * the rest tick on the game thread, and the phase waits for the tasks before returning.
+     * @param Phase - Phase to run
+     * @param DeltaTime - Time elapsed since last tick
+     */
+    void TickPhase(EManagerTickPhase Phase, float DeltaTime);
+
+    // Time-sliced jobs
+
+    /**
+     * Submit a resumable job that runs after the late tick phase. Each frame its step is called
+     * repeatedly until it completes or the frame's budget is spent, and the rest carries over to
+     * the next frame. At least one step runs per frame so every job makes progress.
+     * @param Name - Name used in logs
+     * @param BudgetMs - Time the job may use per frame, in milliseconds
+     * @param Step - Runs one slice of work
+     * @param Owner - Optional object the job works for, the job is dropped once it is destroyed
+     * @return Handle to the job
+     */
+    FManagerJobHandle SubmitJob(FName Name,
+                                float BudgetMs,
+                                FManagerJobStep Step,
+                                const UObject* Owner = nullptr);
+
+    /**
+     * Drop a job without running any more of it.
+     * @param Handle - Job to cancel
+     * @return true if the job was still pending
+     */
+    bool CancelJob(FManagerJobHandle Handle);
+
+    /**
+     * Run a job to completion right away, ignoring its budget. For callers that need the
+     * result now, e.g. a wave starting before spawner collection has finished.
+     * @param Handle - Job to complete
+     * @return true if the job was still pending
+     */
+    bool CompleteJob(FManagerJobHandle Handle);
+
+    bool IsJobPending(FManagerJobHandle Handle) const;
+
+    /**
+     * Give every pending job one frame of work within its budget.
+     */
+    void RunJobs();
+
+    const FManagerJobStats& GetJobStats() const { return JobStats; }
+
+#if !UE_BUILD_SHIPPING
+    // Fixed-step simulation
+
+    /**
+     * Get the fixed step simulations advance by: the engine's fixed step when running with
+     * -UseFixedTimeStep -FPS=, otherwise the game settings.
+     * @return Step length in seconds
+     */
+    static float GetSimulationTimeStep();
+
+    /**
+     * Fast-forward the world by ticking it repeatedly at a fixed step, decoupled from real time
+     * and rendering. Must not be called from inside a world tick.
+     * @param Seconds - Simulated time to advance by
+     * @param StepSeconds - Delta time of each tick, GetSimulationTimeStep if zero or less
+     * @return Number of world ticks run
+     */
+    int32 Simulate(float Seconds, float StepSeconds = 0.0f);
+#endif
+
     // UTickableWorldSubsystem Interface
     virtual bool IsTickable() const override { return true; }
     virtual void Tick(float DeltaTime) override;
     virtual TStatId GetStatId() const override;
 
 private:
+    // World lookup cache, cleared when the cached subsystem deinitializes
+    static const UWorld* CachedWorld;
+    static UManagerHandlerSubsystem* CachedSubsystem;
+
     // Manager storage
 
+    /** Managers indexed by their class's slot, null for classes not in the current set */
     UPROPERTY(Transient)
-    TMap<UClass*, UManagerBase*> Managers;
+    TArray<UManagerBase*> ManagersBySlot;
+
+    /** Managers in initialization order, deinitialized in reverse */
+    UPROPERTY(Transient)
+    TArray<UManagerBase*> OrderedManagers;
+
+    /** Managers grouped by dependency level, for concurrent initialization */
+    TArray<TArray<UManagerBase*>> InitializationLevels;
+
+    /** Managers per tick phase, each in initialization order */
+    TArray<UManagerBase*> PhaseManagers[static_cast<int32>(EManagerTickPhase::MAX)];
+
+    // Late runs from the subsystem's own tick, the earlier phases need tick functions
+    FManagerPhaseTickFunction PrePhysicsTickFunction;
+    FManagerPhaseTickFunction PostPhysicsTickFunction;
+
+    // Job storage
+
+    struct FManagerJob {
+        FManagerJobHandle Handle;
+        FName Name;
+        float BudgetMs = 0.0f;
+        FManagerJobStep Step;
+        TWeakObjectPtr<const UObject> Owner;
+        bool bHasOwner = false;
+        bool bFinished = false;
+        bool bExecuting = false;
+
+        // Average step cost, used to stop before a step that would run past the budget
+        double TotalStepMs = 0.0;
+        int32 StepCount = 0;
+    };
+
+    /** Jobs in submission order, heap-allocated so steps can submit jobs while running */
+    TArray<TUniquePtr<FManagerJob>> Jobs;
+    uint32 NextJobId = 1;
+    bool bRunningJobs = false;
+    FManagerJobStats JobStats;
+
+    /**
+     * Find a job that has not finished.
+     * @param Handle - Job to find
+     * @return Index into Jobs, or INDEX_NONE
+     */
+    int32 FindPendingJob(FManagerJobHandle Handle) const;
+
+    /**
+     * Run one step of a job and record its cost.
+     * @param Job - Job to step
+     * @return Time the step took, in milliseconds
+     */
+    double StepJob(FManagerJob& Job);
+
+    /**
+     * Remove finished jobs and refresh the pending count.
+     */
+    void CompactJobs();
+
+    // Asset preloading
+
+    FStreamableManager StreamableManager;
+
+    /** Handles for every preload round, holding the assets until the managers are cleared */
+    TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+    TSet<FSoftObjectPath> RequestedAssets;
+    TArray<FSoftObjectPath> AdditionalPreloadAssets;
+    EManagerAssetLoading CurrentAssetLoading = EManagerAssetLoading::Blocking;
+    double PreloadStartTime = 0.0;
+    FManagerAssetLoadStats AssetLoadStats;
+
+    bool bManagersReady = false;
+    TArray<FSimpleDelegate> ManagersReadyCallbacks;
+
+    /**
+     * Request every asset not yet requested, round after round, until nothing new is asked for.
+     * Initializes the managers once done, unless a streamed round is still in flight.
+     */
+    void PreloadAssets();
+
+    /**
+     * Collect asset paths from the managers and additional assets that have not been requested.
+     * @param OutAssets - Receives the new paths
+     */
+    void GatherUnrequestedAssets(TArray<FSoftObjectPath>& OutAssets);
+
+    void OnPreloadRoundComplete();
+
+    /**
+     * Record the load time, initialize the managers and run the ready callbacks.
+     */
+    void FinishPreload();
+
+    /**
+     * Tick one manager under its own cycle stat and trace scope. Safe to call from worker ticks.
+     * @param Manager - Manager to tick
+     * @param DeltaTime - Time elapsed since last tick
+     */
+    static void TickManager(UManagerBase& Manager, float DeltaTime);
+
+    /**
+     * Publish each manager's allocated size to its memory stat. Does nothing unless stats are
+     * being collected.
+     */
+    void UpdateMemoryStats() const;
+
+    /**
+     * Register a phase tick function with the world, if not already registered.
+     * @param TickFunction - Tick function to register
+     * @param Phase - Phase it runs
+     * @param TickGroup - World tick group to run it in
+     */
+    void RegisterPhaseTickFunction(FManagerPhaseTickFunction& TickFunction,
+                                   EManagerTickPhase Phase,
+                                   ETickingGroup TickGroup);
+
+    /**
+     * Initialize every manager level by level.
+     */
+    void InitializeManagers();
 };
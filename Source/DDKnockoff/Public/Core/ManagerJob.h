@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ManagerJob.generated.h"
+
+/**
+ * Result of running one step of a time-sliced manager job.
+ */
+UENUM()
+enum class EManagerJobStatus : uint8 {
+    Continue,
+    // More work remains, run another step when budget allows
+    Complete
+    // Job finished, drop it
+};
+
+/**
+ * One resumable slice of work. Keeps its own progress between calls and should do a small,
+ * bounded amount of work per call so the scheduler can stop as soon as the budget is spent.
+ */
+using FManagerJobStep = TFunction<EManagerJobStatus()>;
+
+/**
+ * Reference to a submitted job, stays unique for the lifetime of the subsystem.
+ */
+struct FManagerJobHandle {
+    uint32 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+
+    bool operator==(const FManagerJobHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FManagerJobHandle& Other) const { return Id != Other.Id; }
+
+    friend uint32 GetTypeHash(const FManagerJobHandle& Handle) { return GetTypeHash(Handle.Id); }
+};
+
+/**
+ * Time-sliced job counters, kept by the manager handler subsystem.
+ */
+USTRUCT(BlueprintType)
+struct FManagerJobStats {
+    GENERATED_BODY()
+
+    /** Jobs still waiting for more frames */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Jobs")
+    int32 PendingJobs = 0;
+
+    /** Jobs that have run to completion */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Jobs")
+    int32 CompletedJobs = 0;
+
+    /** Job frames where a single step ran past the job's budget */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Jobs")
+    int32 BudgetOverruns = 0;
+
+    /** Largest amount any job frame has gone over its budget by, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Jobs")
+    float WorstOverrunMs = 0.0f;
+
+    /** Time spent running jobs on the most recent frame, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "Manager Jobs")
+    float LastFrameMs = 0.0f;
+};
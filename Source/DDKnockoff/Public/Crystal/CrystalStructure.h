@@ -45,6 +45,7 @@ public:
     virtual AActor* GetActor() override;
     virtual UEntityData* GetEntityData() const override;
     virtual EEntityType GetEntityType() const override;
+    virtual void ResetEntity() override;
 
     // IDependencyInjectable Interface
     virtual bool HasRequiredDependencies() const override;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DDDamageType.h"
+#include "Entities/EntityHandle.h"
 #include "DamagePayload.generated.h"
 
 class IEntity;
@@ -21,6 +22,10 @@ struct FDamagePayload {
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Damage")
     TScriptInterface<IEntity> DamageInstigator = nullptr;
 
+    /** Registry handle of the instigator, stays safe to hold after the instigator is destroyed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Damage")
+    FEntityHandle InstigatorHandle;
+
     /** Type classification for this damage */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Damage")
     EDDDamageType DamageType = EDDDamageType::None;
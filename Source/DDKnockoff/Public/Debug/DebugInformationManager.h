@@ -23,6 +23,13 @@ public:
     virtual void Initialize() override;
     virtual void Deinitialize() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Samples providers once physics has settled the frame */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PostPhysics;
+    }
 
     // Provider management
 
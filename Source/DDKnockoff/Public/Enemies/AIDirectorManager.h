@@ -0,0 +1,178 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
+#include "Enemies/EnemyCharacterEnums.h"
+#include "Entities/EntityHandle.h"
+#include "UObject/ObjectKey.h"
+#include "AIDirectorManager.generated.h"
+
+class ADDAIController;
+class UCrystalPathFieldManager;
+class UEngagementManager;
+class UEntityManager;
+
+/**
+ * Actions the director asks a controller to carry out this frame, applied in declaration order.
+ */
+enum class EAIDirectorCommand : uint8 {
+    None = 0,
+    StopMovement = 1 << 0,
+    // Cancel the current path and any active movement
+    FindTarget = 1 << 1,
+    // Pick the cheapest crystal to path to
+    MoveToTarget = 1 << 2,
+    // Request a path to the current target
+    Attack = 1 << 3,
+    // Attack the current target if able and holding one of its attack slots
+};
+
+ENUM_CLASS_FLAGS(EAIDirectorCommand);
+
+/**
+ * Runs every enemy's decision making in one batched pass instead of a tick per controller.
+ * Decision state lives here in parallel arrays indexed by agent, and each frame is split into
+ * a game-thread gather of actor state, a pure decision pass over the arrays that goes wide once
+ * there are enough agents, and a game-thread apply that hands the resulting commands to the
+ * controllers.
+ */
+UCLASS()
+class DDKNOCKOFF_API UAIDirectorManager : public UManagerBase, public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Decides before physics so movement requests are picked up the frame they are made */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
+
+    // Agent registration
+
+    /**
+     * Start directing a controller. Its own tick should stay off while registered.
+     * @param Controller - Controller to direct
+     */
+    void RegisterAgent(ADDAIController* Controller);
+
+    /**
+     * Stop directing a controller.
+     * @param Controller - Controller to release
+     */
+    void UnregisterAgent(ADDAIController* Controller);
+
+    bool IsAgentRegistered(const ADDAIController* Controller) const;
+
+    int32 GetNumAgents() const { return Controllers.Num(); }
+
+    // Agent state
+
+    /**
+     * Drop an agent's target so it picks a new one on its next decision.
+     * @param Controller - Agent to retarget
+     */
+    void ClearTarget(const ADDAIController* Controller);
+
+    /**
+     * Let an agent decide on the next tick, whatever its significance tier's decision interval.
+     * @param Controller - Agent to wake
+     */
+    void WakeAgent(const ADDAIController* Controller);
+
+    FEntityHandle GetTarget(const ADDAIController* Controller) const;
+    EEnemyAIState GetState(const ADDAIController* Controller) const;
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    // Batched update passes
+
+    /**
+     * Copy the actor state decisions read into the per-agent arrays, for the agents whose
+     * significance tier lets them decide this frame.
+     * @param Now - Current world time
+     */
+    void GatherAgentState(double Now);
+
+    /**
+     * Run the state machine for one agent, reading and writing only the per-agent arrays.
+     * @param AgentIndex - Agent to decide for
+     * @param Now - Current world time
+     */
+    void DecideAgent(int32 AgentIndex, double Now);
+
+    /**
+     * Hand each agent's commands to its controller.
+     */
+    void ApplyCommands();
+
+    /**
+     * Find the crystal with the lowest navigation path cost from an agent's pawn, using the
+     * crystal path field when it is ready and a path query per crystal otherwise.
+     * @param Controller - Agent searching, used for its world and pawn
+     * @return Handle to the cheapest crystal, or a null handle if none can be reached
+     */
+    FEntityHandle FindCrystalTarget(const ADDAIController& Controller) const;
+
+    /**
+     * Remove an agent by swapping the last agent into its place.
+     * @param AgentIndex - Agent to remove
+     */
+    void RemoveAgentAt(int32 AgentIndex);
+
+    int32 FindAgent(const ADDAIController* Controller) const;
+
+    // Configuration
+
+    /** Agent count from which the decision pass is spread over worker threads */
+    static constexpr int32 ParallelDecisionThreshold = 128;
+
+    // Per-agent decision state, all indexed by agent
+
+    TArray<TWeakObjectPtr<ADDAIController>> Controllers;
+    TArray<TObjectKey<ADDAIController>> ControllerKeys;
+    TArray<EEnemyAIState> States;
+    TArray<FEntityHandle> Targets;
+    TArray<double> NextRetargetTimes;
+    TArray<float> RetargetIntervals;
+    TArray<double> NextDecisionTimes;
+    TArray<EAIDirectorCommand> Commands;
+
+    // Per-agent inputs, refreshed by the gather pass each frame
+
+    TBitArray<> CanDecide;
+    TBitArray<> OverlappingDefense;
+    TBitArray<> PathIdle;
+    TBitArray<> TargetValid;
+    TArray<FEntityHandle> ClosestOverlaps;
+
+    /** Agents holding or queued for an attack slot, released once they stop attacking */
+    TBitArray<> Engaged;
+
+    /** Agent index per controller, for constant-time lookups from controllers */
+    TMap<TObjectKey<ADDAIController>, int32> AgentIndices;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEntityManager> EntityManager;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UCrystalPathFieldManager> CrystalPathField;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEngagementManager> Engagement;
+
+    // Statistics, from the most recent frame
+
+    int32 LastDecidingAgents = 0;
+    int32 LastTargetSearches = 0;
+    float LastUpdateMs = 0.0f;
+};
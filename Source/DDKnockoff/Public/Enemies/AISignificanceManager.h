@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
+#include "Enemies/EnemyCharacterEnums.h"
+#include "AISignificanceManager.generated.h"
+
+class ADDAICharacter;
+class UEngagementManager;
+class UEntityManager;
+
+/**
+ * Update rates an enemy runs at within one significance tier. Zero means every frame.
+ */
+struct FAISignificanceTierSettings {
+    /** Seconds between AI director decisions */
+    float DecisionInterval = 0.0f;
+
+    /** Seconds between actor ticks, which re-score the overlapped structures */
+    float OverlapPollInterval = 0.0f;
+
+    /** Seconds between skeletal mesh ticks, which update the animation */
+    float AnimationTickInterval = 0.0f;
+
+    /** Seconds between character movement ticks */
+    float MovementTickInterval = 0.0f;
+};
+
+/**
+ * Assigns every enemy a significance tier from its distance to the nearest defense or crystal,
+ * its distance to the player cameras and whether it was rendered recently. Enemies queued for
+ * an attack slot only hold position, so they idle in the lowest tier. The tier sets how
+ * often the enemy decides, polls for overlaps, animates and moves, so enemies walking down a
+ * far lane cost a fraction of the ones fighting at the defenses. Enemies are re-evaluated a
+ * fixed number per frame, cycling through the whole population.
+ */
+UCLASS()
+class DDKNOCKOFF_API UAISignificanceManager : public UManagerBase, public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override { return ViewLocations.GetAllocatedSize(); }
+
+    /** Evaluates after movement so tiers are taken from where enemies ended up this frame */
+    virtual EManagerTickPhase GetTickPhase() const override { return EManagerTickPhase::Late; }
+
+    // Tiers
+
+    /**
+     * Update rates for a significance tier.
+     * @param Tier - Tier to look up
+     * @return Settings shared by every enemy in the tier
+     */
+    static const FAISignificanceTierSettings& GetTierSettings(EAISignificanceTier Tier);
+
+    /**
+     * Work out the tier of an enemy from where it stands.
+     * @param Character - Enemy to evaluate
+     * @param CameraLocations - Locations of the player cameras, empty when nobody is watching
+     * @return Tier the enemy belongs in
+     */
+    EAISignificanceTier EvaluateTier(const ADDAICharacter& Character,
+                                     TConstArrayView<FVector> CameraLocations) const;
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    /**
+     * Distance to the closest targetable defense or crystal.
+     * @param Location - Location to measure from
+     * @return Distance, or FLT_MAX if no structure is within the medium tier range
+     */
+    float GetDistanceToNearestStructure(const FVector& Location) const;
+
+    /**
+     * Collect the camera location of every local player.
+     */
+    void GatherViewLocations();
+
+    // Configuration
+
+    /** Enemies re-evaluated per frame at most */
+    static constexpr int32 MaxEvaluationsPerFrame = 64;
+
+    /** Enemies this close to a structure are engaged, whether or not anyone is watching */
+    static constexpr float HighStructureDistance = 1500.0f;
+
+    /** Enemies this close to a structure are approaching the defenses */
+    static constexpr float MediumStructureDistance = 4000.0f;
+
+    /** On-screen enemies this close to a camera are in the player's face */
+    static constexpr float HighViewDistance = 2500.0f;
+
+    /** Enemies this close to a camera can be seen moving even when briefly off screen */
+    static constexpr float MediumViewDistance = 6000.0f;
+
+    /** Seconds since the last render for an enemy to count as on screen */
+    static constexpr float OnScreenTimeTolerance = 0.25f;
+
+    // Evaluation state
+
+    /** Index into the enemy view where the next frame's evaluations start */
+    int32 EvaluationCursor = 0;
+
+    TArray<FVector> ViewLocations;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEntityManager> EntityManager;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEngagementManager> Engagement;
+
+    // Statistics, from the most recent frame
+
+    int32 LastEvaluations = 0;
+    int32 LastTierChanges = 0;
+};
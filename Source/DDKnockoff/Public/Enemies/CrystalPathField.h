@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Entities/EntityHandle.h"
+
+/**
+ * Coarse grid of travel costs to the nearest crystal, solved from every crystal at once.
+ * Each cell holds a traversal cost multiplier; solving runs a multi-source Dijkstra over the
+ * grid, after which any location can be looked up for the crystal that is cheapest to reach
+ * from it and the cost of getting there. A solve can be spread over several calls, and the
+ * previous result keeps answering lookups until it completes. Has no navigation dependency of
+ * its own - the owner fills in cell costs however it likes.
+ */
+class DDKNOCKOFF_API FCrystalPathField {
+public:
+    /** Cost of a cell that cannot be walked at all */
+    static constexpr float BlockedCost = TNumericLimits<float>::Max();
+
+    /** A crystal the field measures distances to */
+    struct FSource {
+        FVector Location = FVector::ZeroVector;
+        FEntityHandle Handle;
+    };
+
+    // Grid setup
+
+    /**
+     * Resize the grid to cover an area, resetting every cell to a cost of one and dropping
+     * any solved distances.
+     * @param Bounds - World area to cover, only X and Y are gridded
+     * @param InCellSize - Cell edge length in world units
+     */
+    void Reset(const FBox& Bounds, float InCellSize);
+
+    bool IsInitialized() const { return CellCosts.Num() > 0; }
+    int32 Num() const { return CellCosts.Num(); }
+    FIntPoint GetGridSize() const { return GridSize; }
+    float GetCellSize() const { return CellSize; }
+
+    /**
+     * Find the cell containing a location.
+     * @param Location - World location
+     * @return Cell index, or INDEX_NONE if outside the grid
+     */
+    int32 GetCellIndex(const FVector& Location) const;
+
+    /**
+     * Get the world-space center of a cell, at the height of the grid's bounds center.
+     * @param CellIndex - Cell to locate
+     * @return Cell center
+     */
+    FVector GetCellCenter(int32 CellIndex) const;
+
+    // Costs
+
+    /**
+     * Set a cell's traversal cost multiplier. Takes effect on the next Solve.
+     * @param CellIndex - Cell to update
+     * @param Cost - Cost multiplier, BlockedCost for cells that cannot be walked
+     */
+    void SetCellCost(int32 CellIndex, float Cost);
+
+    float GetCellCost(int32 CellIndex) const { return CellCosts[CellIndex]; }
+
+    /**
+     * Take over another field's grid and cell costs. Solved distances are kept if the grid is
+     * unchanged, and dropped otherwise.
+     * @param Other - Field to copy the costs of
+     */
+    void CopyCosts(const FCrystalPathField& Other);
+
+    // Solving and sampling
+
+    /**
+     * Recompute every cell's cost to its cheapest source in one go.
+     * @param Sources - Crystals to measure to, sources outside the grid or on blocked cells
+     *                  are ignored
+     */
+    void Solve(TConstArrayView<FSource> Sources);
+
+    /**
+     * Start an incremental solve, replacing any solve in progress. Lookups keep using the
+     * previous result until StepSolve completes. Source cells start at zero cost and their own
+     * cost is not charged, so a crystal sitting in an expensive nav area does not offset the
+     * whole field.
+     * @param Sources - Crystals to measure to, sources outside the grid or on blocked cells
+     *                  are ignored
+     */
+    void BeginSolve(TConstArrayView<FSource> Sources);
+
+    /**
+     * Continue an incremental solve, publishing the result once every cell is settled.
+     * @param MaxCells - Cells to expand at most
+     * @return true if the solve has completed, or none was in progress
+     */
+    bool StepSolve(int32 MaxCells);
+
+    bool IsSolving() const { return bSolving; }
+
+    bool IsSolved() const { return Distances.Num() == CellCosts.Num() && Distances.Num() > 0; }
+
+    /**
+     * Look up the cheapest crystal to reach from a location. Locations on blocked or unreached
+     * cells fall back to the best neighbouring cell, so agents hugging walls still resolve.
+     * @param Location - World location to sample
+     * @param OutSource - Receives the cheapest crystal's handle
+     * @param OutCost - Receives the travel cost to it, in cost-weighted world units
+     * @return false if no crystal can be reached from the location
+     */
+    bool Sample(const FVector& Location, FEntityHandle& OutSource, float& OutCost) const;
+
+    /**
+     * Get the direction to walk from a location to descend the field towards its crystal,
+     * pointing at the center of the cheapest neighbouring cell.
+     * @param Location - World location to steer from
+     * @param OutDirection - Receives the normalized 2D direction, zero once on a crystal's cell
+     * @return false if no crystal can be reached from the location
+     */
+    bool GetFlowDirection(const FVector& Location, FVector& OutDirection) const;
+
+    SIZE_T GetAllocatedSize() const {
+        return CellCosts.GetAllocatedSize() + Distances.GetAllocatedSize()
+               + NearestSources.GetAllocatedSize() + SourceHandles.GetAllocatedSize()
+               + PendingDistances.GetAllocatedSize() + PendingNearestSources.GetAllocatedSize()
+               + PendingSourceHandles.GetAllocatedSize() + PendingSourceCells.GetAllocatedSize()
+               + OpenCells.GetAllocatedSize();
+    }
+
+private:
+    /** A cell waiting to be expanded by the solve, with the distance it was queued at */
+    struct FOpenCell {
+        float Distance;
+        int32 CellIndex;
+
+        bool operator<(const FOpenCell& Other) const { return Distance < Other.Distance; }
+    };
+
+    bool IsBlocked(const int32 CellIndex) const { return CellCosts[CellIndex] == BlockedCost; }
+
+    /**
+     * Drop the solved result and any solve in progress.
+     */
+    void ResetSolve();
+
+    FVector2D Origin = FVector2D::ZeroVector;
+    double GridZ = 0.0;
+    float CellSize = 1.0f;
+    FIntPoint GridSize = FIntPoint::ZeroValue;
+
+    /** Traversal cost multiplier per cell, row-major */
+    TArray<float> CellCosts;
+
+    /** Solved cost to the nearest source per cell, MAX_flt where unreached */
+    TArray<float> Distances;
+
+    /** Index into SourceHandles of each cell's nearest source, INDEX_NONE where unreached */
+    TArray<int32> NearestSources;
+
+    TArray<FEntityHandle> SourceHandles;
+
+    // Incremental solve state, swapped into the arrays above once the solve completes
+
+    TArray<float> PendingDistances;
+    TArray<int32> PendingNearestSources;
+    TArray<FEntityHandle> PendingSourceHandles;
+
+    /** Cells holding a source, whose own cost is not charged */
+    TBitArray<> PendingSourceCells;
+
+    /** Open set of the solve in progress, as a min-heap on distance */
+    TArray<FOpenCell> OpenCells;
+
+    bool bSolving = false;
+};
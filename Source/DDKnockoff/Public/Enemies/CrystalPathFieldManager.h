@@ -0,0 +1,203 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Core/ManagerJob.h"
+#include "Debug/DebugInformationProvider.h"
+#include "Enemies/CrystalPathField.h"
+#include "Entities/EntityChangeJournal.h"
+#include "CrystalPathFieldManager.generated.h"
+
+class ANavigationData;
+class UEntityManager;
+class UNavigationSystemV1;
+
+/**
+ * Keeps a coarse path-cost field from every crystal over the navmesh, so enemies pick their
+ * crystal with a single field sample instead of a navigation path query per crystal.
+ * Cell costs are sampled from the navmesh's area classes, which is where defensive structures
+ * and chests make themselves expensive to walk through. When structures are placed or removed
+ * only the cells under them are resampled, in a time-sliced job that waits for the navmesh to
+ * finish rebuilding first, and then the field is re-solved over the following slices while
+ * queries keep using the previous solve. Per-crystal fields for enemies
+ * steering by flow field are derived from the same cell costs on request, and re-solved by
+ * the same job after every solve of the main field.
+ */
+UCLASS()
+class DDKNOCKOFF_API UCrystalPathFieldManager : public UManagerBase,
+                                                public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    // Queries
+
+    /**
+     * Whether the field has been solved at least once and can answer queries.
+     * @return true if FindNearestCrystal is usable
+     */
+    bool IsFieldReady() const { return Field.IsSolved(); }
+
+    /**
+     * Find the crystal that is cheapest to walk to from a location.
+     * @param Location - World location to search from
+     * @param OutPathCost - Optionally receives the path cost to the crystal
+     * @return Handle to the crystal, or a null handle if none can be reached or the field is
+     *         not ready yet
+     */
+    FEntityHandle FindNearestCrystal(const FVector& Location, float* OutPathCost = nullptr) const;
+
+    /** The field solved towards every crystal at once */
+    const FCrystalPathField& GetField() const { return Field; }
+
+    /**
+     * Ask for a field solved towards a single crystal, shared by every agent heading for it.
+     * The field is solved by the rebuild job, and re-solved after every solve of the main field.
+     * @param Goal - Crystal to steer towards
+     * @return false if the field is not ready or the goal is no crystal
+     */
+    bool RequestGoalField(const FEntityHandle& Goal);
+
+    /**
+     * Get a requested single-crystal field. While it is being re-solved the previous result is
+     * returned. Requesting another goal may move the stored fields, so do not hold on to the
+     * returned pointer across requests.
+     * @param Goal - Crystal to steer towards
+     * @return The goal's field, or nullptr if it was never requested or is not solved yet
+     */
+    const FCrystalPathField* GetGoalField(const FEntityHandle& Goal) const;
+
+    // Updates
+
+    /**
+     * Resample the cells overlapping an area once the navmesh has caught up, e.g. after
+     * changing a nav modifier's area class.
+     * @param Bounds - World area whose navigation cost changed
+     */
+    void MarkAreaDirty(const FBox& Bounds);
+
+    /**
+     * Mark the crystal set as changed so the field is re-solved.
+     */
+    void MarkSourcesDirty();
+
+    bool IsRebuildPending() const;
+
+    /**
+     * Size the grid to an area with every cell walkable and solve it, for worlds without a
+     * navmesh such as the test worlds.
+     * @param Bounds - World area to cover
+     */
+    void ResetGridForTesting(const FBox& Bounds);
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    /**
+     * Start or continue the time-sliced rebuild job.
+     */
+    void ScheduleRebuild();
+
+    /**
+     * Run one slice of the rebuild, resampling dirty cells and solving once none are left.
+     * @return Whether the rebuild has finished
+     */
+    EManagerJobStatus RebuildStep();
+
+    /**
+     * Size the grid to the navmesh's bounds and mark every cell dirty.
+     * @param NavData - Navigation data to cover
+     */
+    void ResetGrid(const ANavigationData& NavData);
+
+    /**
+     * Read a cell's cost from the navmesh at its center.
+     * @param NavSys - Navigation system to query
+     * @param NavData - Navigation data to query
+     * @param CellIndex - Cell to sample
+     */
+    void SampleCell(const UNavigationSystemV1& NavSys, const ANavigationData& NavData, int32 CellIndex);
+
+    /**
+     * Start re-solving the field from the current crystals.
+     */
+    void BeginSolveField();
+
+    /**
+     * Expand one batch of cells of the solve in progress.
+     * @return true once the solve has completed and the field is updated
+     */
+    bool StepSolveField();
+
+    /**
+     * Expand one batch of cells of the goal field at the front of the queue, starting its solve
+     * from the current cell costs if needed. Goals that are no longer crystals are dropped.
+     */
+    void StepGoalField();
+
+    void OnEntityChanges(TConstArrayView<FEntityChangeRecord> Changes);
+
+    UFUNCTION()
+    void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+    // Configuration
+
+    /** Edge length of a field cell in world units */
+    static constexpr float CellSize = 200.0f;
+
+    /** Cells per side above which the cell size grows, to bound memory and solve time */
+    static constexpr int32 MaxCellsPerSide = 256;
+
+    /** Time the rebuild job may use per frame, in milliseconds */
+    static constexpr float RebuildBudgetMs = 1.0f;
+
+    /** Cells resampled per rebuild step */
+    static constexpr int32 CellsPerRebuildStep = 64;
+
+    /** Cells expanded per rebuild step while solving */
+    static constexpr int32 CellsPerSolveStep = 1024;
+
+    // Field state
+
+    FCrystalPathField Field;
+
+    /** Single-crystal fields for flow-field movement, keyed by crystal */
+    TMap<FEntityHandle, FCrystalPathField> GoalFields;
+
+    /** Goal fields waiting to be solved, in request order */
+    TArray<FEntityHandle> PendingGoalFields;
+
+    /** Cells waiting to be resampled, with a bit per cell so each is only queued once */
+    TArray<int32> DirtyCells;
+    TBitArray<> DirtyCellFlags;
+
+    /** Whether the field needs solving again once the dirty cells are resampled */
+    bool bSolvePending = false;
+
+    /** Bounds of tracked structures, kept so their cells can be dirtied after removal */
+    TMap<FEntityHandle, FBox> StructureBounds;
+
+    FManagerJobHandle RebuildJob;
+    FDelegateHandle EntityChangesHandle;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEntityManager> EntityManager;
+
+    // Statistics
+
+    int32 NumSolves = 0;
+    int32 LastResampledCells = 0;
+
+    /** Time spent on the solve in progress, summed over its slices */
+    float CurrentSolveMs = 0.0f;
+
+    /** Time the last completed solve took, summed over its slices */
+    float LastSolveMs = 0.0f;
+};
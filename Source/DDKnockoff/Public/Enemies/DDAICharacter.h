@@ -71,12 +71,23 @@ public:
 
     /**
      * Get the closest overlapping defensive structure for pathfinding.
-     * @return Weak pointer to closest structure or null
+     * @return Handle to closest structure, resolve through the entity manager
      */
-    TWeakObjectPtr<AActor> GetClosestOverlappingStructure() const;
+    FEntityHandle GetClosestOverlappingStructure() const;
 
     EEnemyPoseState GetCurrentPoseState() const;
+    EEnemyMovementMode GetMovementMode() const { return MovementMode; }
     CharacterActorOverlapState GetActorOverlapState() const;
+    EAISignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
+    // Significance
+
+    /**
+     * Move the character to a significance tier, applying the tier's overlap poll, animation and
+     * movement tick intervals. Decision rate is read from the tier by the AI director.
+     * @param Tier - Tier to apply
+     */
+    void SetSignificanceTier(EAISignificanceTier Tier);
 
     // Event handlers
 
@@ -91,6 +102,20 @@ public:
     UFUNCTION()
     void OnDeath();
 
+    UFUNCTION()
+    void OnTargetDetectionBeginOverlap(UPrimitiveComponent* OverlappedComponent,
+                                       AActor* OtherActor,
+                                       UPrimitiveComponent* OtherComp,
+                                       int32 OtherBodyIndex,
+                                       bool bFromSweep,
+                                       const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnTargetDetectionEndOverlap(UPrimitiveComponent* OverlappedComponent,
+                                     AActor* OtherActor,
+                                     UPrimitiveComponent* OtherComp,
+                                     int32 OtherBodyIndex);
+
     // Events
 
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCapsuleColliderHit,
@@ -154,21 +179,59 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Currency")
     int32 MinimumCrystalCount = 1;
 
+    /** Flow field suits enemy classes that come in large numbers down the same lanes */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
+    EEnemyMovementMode MovementMode = EEnemyMovementMode::Pathfinding;
+
     // Runtime state
 
     FVector TargetLocation;
     CharacterActorOverlapState ActorOverlapState = CharacterActorOverlapState::None;
 
-    UPROPERTY(Transient)
-    TArray<AActor*> ActorsInDetectionRange;
+    /** Full rate until the significance manager has evaluated the character */
+    EAISignificanceTier SignificanceTier = EAISignificanceTier::High;
+
+    /** Defenses and crystals inside the target detection collider, kept by overlap events */
+    TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> OverlapCandidates;
+
+    /** Candidates were added or removed since they were last scored */
+    bool bOverlapCandidatesDirty = false;
+
+    /** A candidate was unregistered or untargetable when last scored, and may become valid */
+    bool bHasPendingOverlapCandidates = false;
+
+    /** Where the candidates were last scored, to notice when a different one becomes closest */
+    FVector LastOverlapScoreLocation = FVector::ZeroVector;
 
     UPROPERTY(Transient, Instanced)
     TObjectPtr<UEntityData> EntityData;
 
     UPROPERTY(Transient)
-    TWeakObjectPtr<AActor> ClosestOverlappingStructure;
+    FEntityHandle ClosestOverlappingStructure;
 
 private:
+    // Overlap tracking
+
+    /**
+     * Add an actor to the overlap candidates if it is a defense or crystal.
+     * @param Actor - Actor that started overlapping the target detection collider
+     */
+    void AddOverlapCandidate(AActor* Actor);
+
+    /**
+     * Check whether the closest overlapping structure may have changed since the last score.
+     * @return true if the candidates need scoring again
+     */
+    bool NeedsOverlapRescore() const;
+
+    /**
+     * Pick the closest targetable candidate and update the overlap state from it.
+     */
+    void ScoreOverlapCandidates();
+
+    /** Distance the character walks before several candidates are scored again */
+    static constexpr float OverlapRescoreDistance = 50.0f;
+
     // Dependencies
 
     UPROPERTY(Transient)
@@ -7,12 +7,14 @@
 #include "DDAIController.generated.h"
 
 class ADDAICharacter;
-class IEntity;
+class UAIDirectorManager;
+class UFlowFieldMovementManager;
+class UPathRequestManager;
 
 /**
- * AI controller for enemy characters with state-based behavior and target acquisition.
- * Manages pathfinding, combat decisions, and target prioritization for defensive structure destruction.
- * Features knockback response and dynamic state transitions based on environment conditions.
+ * AI controller for enemy characters, carrying out the AI director's decisions.
+ * Registers with UAIDirectorManager on possession and never ticks itself; the director decides
+ * for every enemy in one batched pass and calls back into the controller to move and attack.
  */
 UCLASS()
 class DDKNOCKOFF_API ADDAIController : public AAIController, public IConfigurationValidatable {
@@ -24,78 +26,45 @@ public:
     // IConfigurationValidatable Interface Implementation
     virtual void ValidateConfiguration() const override;
 
-protected:
-    // Actor lifecycle
-    virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
-    virtual void OnPossess(APawn* InPawn) override;
-
-    // Configuration
-
-    UPROPERTY(EditDefaultsOnly, Category = "AI|Movement")
-    float AcceptanceRadius = 5.0f;
-
-    UPROPERTY(EditDefaultsOnly, Category = "AI|Targeting")
-    float TargetUpdateInterval = 2.0f;
-
-private:
-    // Event handlers
+    // Director queries
 
     /**
-     * Handle character knockback events to update AI state.
-     */
-    UFUNCTION()
-    void OnCharacterTookKnockback();
-
-    // State management
-
-    /**
-     * Process current AI state and execute appropriate behavior.
-     */
-    void ProcessCurrentState();
-
-    /**
-     * Handle behavior during idle state.
+     * Check if AI can make decisions (not stunned, valid character, etc.).
+     * @return true if decisions can be made
      */
-    void HandleIdleState();
+    bool CanMakeDecisions() const;
 
     /**
-     * Handle behavior during movement state.
+     * Check if pathfinding component is in idle state, with no path pending and no flow field
+     * being followed.
+     * @return true if path component is idle
      */
-    void HandleMovingState();
+    bool IsPathComponentIdle() const;
 
-    /**
-     * Handle behavior during attacking state.
-     */
-    void HandleAttackingState();
+    ADDAICharacter* GetAICharacter() const { return AICharacter; }
 
-    /**
-     * Transition to a new AI state with proper cleanup.
-     * @param NewState - State to transition to
-     */
-    void TransitionToState(EEnemyAIState NewState);
+    float GetTargetUpdateInterval() const { return TargetUpdateInterval; }
 
-    // State validation
+    // Director commands
 
     /**
-     * Check if AI can make decisions (not stunned, valid character, etc.).
-     * @return true if decisions can be made
+     * Stop all current movement and pathfinding operations.
      */
-    bool CanMakeDecisions() const;
+    void StopPathingAndMovement();
 
     /**
-     * Check if targeting should be updated based on time interval.
-     * @return true if targeting update is needed
+     * Request a path to a target, found asynchronously through UPathRequestManager. Characters
+     * using flow-field movement follow the target's shared flow field instead when it has one.
+     * @param Target - Actor to move to
      */
-    bool ShouldUpdateTargeting() const;
+    void MoveToTarget(AActor& Target);
 
     /**
-     * Check if character is overlapping with defensive structures.
-     * @return true if overlapping with defense
+     * Start following a path found for this controller.
+     * @param Path - Path to follow
+     * @param Target - Actor the path leads to
      */
-    bool CharacterIsOverlappingADefense() const;
-
-    // Combat
+    void FollowPath(const FNavPathSharedPtr& Path, AActor& Target);
 
     /**
      * Attempt to attack the target if conditions are met.
@@ -103,36 +72,29 @@ private:
      */
     void AttackIfAble(AActor& Target) const;
 
-    // Movement
-
-    /**
-     * Stop all current movement and pathfinding operations.
-     */
-    void StopPathingAndMovement();
+protected:
+    // Actor lifecycle
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void OnPossess(APawn* InPawn) override;
+    virtual void OnUnPossess() override;
 
-    /**
-     * Initiate movement toward current target.
-     */
-    void MoveToTarget();
+    // Configuration
 
-    /**
-     * Check if pathfinding component is in idle state.
-     * @return true if path component is idle
-     */
-    bool CheckIfPathComponentIsIdle() const;
+    UPROPERTY(EditDefaultsOnly, Category = "AI|Movement")
+    float AcceptanceRadius = 5.0f;
 
-    // Target acquisition
+    UPROPERTY(EditDefaultsOnly, Category = "AI|Targeting")
+    float TargetUpdateInterval = 2.0f;
 
-    /**
-     * Update current target based on priority and availability.
-     */
-    void UpdateTarget();
+private:
+    // Event handlers
 
     /**
-     * Validate current target is still valid and accessible.
-     * @return true if target is valid
+     * Handle character knockback events by dropping the current path and target.
      */
-    bool TargetIsValid() const;
+    UFUNCTION()
+    void OnCharacterTookKnockback();
 
     // Runtime state
 
@@ -140,8 +102,12 @@ private:
     ADDAICharacter* AICharacter;
 
     UPROPERTY(Transient)
-    TWeakObjectPtr<AActor> TargetStructure;
+    TObjectPtr<UAIDirectorManager> AIDirector;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UPathRequestManager> PathRequests;
 
-    EEnemyAIState CurrentAIState;
-    float LastTargetUpdateTime = 0.0f;
+    /** Set while the possessed character uses flow-field movement */
+    UPROPERTY(Transient)
+    TObjectPtr<UFlowFieldMovementManager> FlowFieldMovement;
 };
@@ -31,6 +31,34 @@ enum class EEnemyAIState : uint8 {
     MAX UMETA(Hidden)
 };
 
+/**
+ * How an enemy class moves towards its target.
+ */
+UENUM(BlueprintType)
+enum class EEnemyMovementMode : uint8 {
+    Pathfinding UMETA(DisplayName = "Pathfinding"),
+    // Individual navmesh path with crowd avoidance
+    FlowField UMETA(DisplayName = "Flow Field"),
+    // Follow the shared flow field of the target crystal with bulk separation, for large crowds
+
+    MAX UMETA(Hidden)
+};
+
+/**
+ * How much of an enemy's update budget it gets, from its distance to the action and the camera.
+ */
+UENUM(BlueprintType)
+enum class EAISignificanceTier : uint8 {
+    High UMETA(DisplayName = "High"),
+    // Engaging a structure or close on screen, updated every frame
+    Medium UMETA(DisplayName = "Medium"),
+    // Visible or approaching the defenses, updated at a reduced rate
+    Low UMETA(DisplayName = "Low"),
+    // Walking a far lane off screen, updated only as often as it needs to keep walking
+
+    MAX UMETA(Hidden)
+};
+
 /**
  * Overlap state enumeration for character collision detection.
  */
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
+#include "Entities/EntityChangeJournal.h"
+#include "Entities/EntityHandle.h"
+#include "UObject/ObjectKey.h"
+#include "EngagementManager.generated.h"
+
+class ADDAIController;
+class UEntityManager;
+
+/**
+ * Attack slots around one structure and the enemies waiting for them.
+ */
+struct FStructureEngagement {
+    /** Controllers allowed to attack the structure */
+    TArray<TObjectKey<ADDAIController>, TInlineAllocator<4>> SlotHolders;
+
+    /** Controllers waiting for a slot, in the order they arrived */
+    TArray<TObjectKey<ADDAIController>> Queue;
+};
+
+/**
+ * Hands out a limited number of attack slots around each structure. Enemies that reach a
+ * structure whose slots are all taken queue for one and hold position in a low-rate idle,
+ * and the longest-waiting enemy takes over each slot as it frees up. This bounds how many
+ * attack animations and hitbox overlaps a single structure sees, and the slot count doubles
+ * as a difficulty control. Engagements of removed or untargetable structures are dropped
+ * from the entity change journal.
+ */
+UCLASS()
+class DDKNOCKOFF_API UEngagementManager : public UManagerBase, public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Frees the slots of destroyed enemies before the AI director asks for them */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
+
+    // Slots
+
+    /**
+     * Ask for a slot to attack a structure. Enemies without one join the structure's queue, and
+     * a request for a different structure gives up the previous slot or place in queue.
+     * @param Controller - Enemy asking to attack
+     * @param Structure - Structure to attack
+     * @return true if the enemy holds a slot and may attack
+     */
+    bool RequestSlot(ADDAIController* Controller, const FEntityHandle& Structure);
+
+    /**
+     * Give up a slot or place in queue, handing a freed slot to the next enemy in line.
+     * @param Controller - Enemy leaving the engagement
+     */
+    void ReleaseSlot(const ADDAIController* Controller);
+
+    bool HasSlot(const ADDAIController* Controller) const;
+
+    /** Whether the enemy is queued for a slot, holding position until one frees up */
+    bool IsWaitingForSlot(const ADDAIController* Controller) const;
+
+    int32 GetNumSlotHolders(const FEntityHandle& Structure) const;
+    int32 GetQueueLength(const FEntityHandle& Structure) const;
+
+    // Configuration
+
+    /**
+     * Set how many enemies may attack one structure at once. Existing slot holders keep their
+     * slots, and queued enemies take any slots the change opens up.
+     * @param InSlotsPerStructure - Attack slots per structure, at least one
+     */
+    void SetSlotsPerStructure(int32 InSlotsPerStructure);
+
+    int32 GetSlotsPerStructure() const { return SlotsPerStructure; }
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    /**
+     * Drop engagements of structures that were removed or became untargetable.
+     */
+    void OnEntityChanges(TConstArrayView<FEntityChangeRecord> Changes);
+
+    /**
+     * Remove destroyed enemies and hand free slots to the front of the queue.
+     * @param Engagement - Engagement to fill
+     */
+    void FillSlots(FStructureEngagement& Engagement);
+
+    /**
+     * Drop a structure's engagement, releasing every enemy in it.
+     * @param Structure - Structure whose engagement to drop
+     */
+    void RemoveEngagement(const FEntityHandle& Structure);
+
+    // Configuration
+
+    static constexpr int32 DefaultSlotsPerStructure = 4;
+
+    int32 SlotsPerStructure = DefaultSlotsPerStructure;
+
+    // Engagement state
+
+    TMap<FEntityHandle, FStructureEngagement> Engagements;
+
+    /** Structure each engaged enemy holds a slot at or is queued for */
+    TMap<TObjectKey<ADDAIController>, FEntityHandle> ControllerEngagements;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEntityManager> EntityManager;
+
+    FDelegateHandle EntityChangesHandle;
+
+    // Statistics
+
+    int32 TotalPromotions = 0;
+};
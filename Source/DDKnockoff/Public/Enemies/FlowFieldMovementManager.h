@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
+#include "Entities/EntityHandle.h"
+#include "UObject/ObjectKey.h"
+#include "FlowFieldMovementManager.generated.h"
+
+class ADDAICharacter;
+class FCrystalPathField;
+class UCrystalPathFieldManager;
+
+/**
+ * Moves enemies that use EEnemyMovementMode::FlowField. Agents heading for the same crystal
+ * share one flow field from UCrystalPathFieldManager instead of each following its own path,
+ * and local avoidance is a single separation pass over a uniform grid of agent positions
+ * instead of crowd simulation. Like the AI director, each frame is a game-thread gather, a
+ * steering pass over the per-agent arrays that goes wide with enough agents, and a
+ * game-thread apply that feeds the result to the characters as movement input.
+ */
+UCLASS()
+class DDKNOCKOFF_API UFlowFieldMovementManager : public UManagerBase,
+                                                 public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Steers after the AI director so goals set this frame are followed straight away */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
+
+    // Agents
+
+    /**
+     * Start or retarget flow-field movement for a character.
+     * @param Character - Character to move
+     * @param Goal - Crystal to head for
+     * @return false if no flow field can be solved towards the goal, in which case the
+     *         character is not moved and should path to the goal instead
+     */
+    bool SetAgentGoal(ADDAICharacter* Character, const FEntityHandle& Goal);
+
+    /**
+     * Stop moving a character. Does nothing if it is not following a flow field.
+     * @param Character - Character to release
+     */
+    void RemoveAgent(const ADDAICharacter* Character);
+
+    bool IsAgentFollowing(const ADDAICharacter* Character) const;
+
+    /**
+     * Movement input the character was last given, its flow direction plus separation from
+     * its neighbours.
+     * @param Character - Character to look up
+     * @return Direction of at most unit length, zero if the character is not following a flow
+     *         field
+     */
+    FVector GetAgentDirection(const ADDAICharacter* Character) const;
+
+    int32 GetNumAgents() const { return Characters.Num(); }
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    // Batched update passes
+
+    /**
+     * Copy agent positions, resolve each agent's goal field and bucket agents by grid cell.
+     */
+    void GatherAgentState();
+
+    /**
+     * Combine an agent's flow direction with separation from its neighbours, reading the
+     * per-agent arrays and writing only the agent's own direction.
+     * @param AgentIndex - Agent to steer
+     */
+    void SteerAgent(int32 AgentIndex);
+
+    /**
+     * Feed each agent's direction to its character as movement input.
+     */
+    void ApplyDirections();
+
+    /**
+     * Remove an agent by swapping the last agent into its place.
+     * @param AgentIndex - Agent to remove
+     */
+    void RemoveAgentAt(int32 AgentIndex);
+
+    FIntPoint GetSeparationCell(const FVector& Location) const;
+
+    // Configuration
+
+    /** Distance within which agents push each other apart, also the separation grid's cell size */
+    static constexpr float SeparationRadius = 120.0f;
+
+    /** Strength of separation relative to the flow direction */
+    static constexpr float SeparationWeight = 1.5f;
+
+    /** Agent count from which the steering pass is spread over worker threads */
+    static constexpr int32 ParallelSteeringThreshold = 128;
+
+    // Per-agent state, all indexed by agent
+
+    TArray<TWeakObjectPtr<ADDAICharacter>> Characters;
+    TArray<TObjectKey<ADDAICharacter>> CharacterKeys;
+    TArray<FEntityHandle> Goals;
+    TArray<FVector> Locations;
+    TArray<FVector> Directions;
+    TBitArray<> CanMove;
+
+    /** Goal field per agent, only valid between the gather and steering passes */
+    TArray<const FCrystalPathField*> AgentFields;
+
+    /** Agent index per character, for constant-time lookups from controllers */
+    TMap<TObjectKey<ADDAICharacter>, int32> AgentIndices;
+
+    // Separation grid, rebuilt every frame
+
+    /** Agent indices sorted by separation cell */
+    TArray<int32> SortedAgents;
+    TArray<FIntPoint> AgentCells;
+
+    /** First entry in SortedAgents and agent count per occupied cell */
+    TMap<FIntPoint, TPair<int32, int32>> CellRanges;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UCrystalPathFieldManager> CrystalPathField;
+
+    // Statistics, from the most recent frame
+
+    int32 LastOccupiedCells = 0;
+    float LastUpdateMs = 0.0f;
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
+#include "NavigationSystemTypes.h"
+#include "UObject/ObjectKey.h"
+#include "PathRequestManager.generated.h"
+
+class ADDAIController;
+
+/**
+ * Identifies requests that can share one path: same goal, starting in the same region.
+ */
+struct FPathRequestKey {
+    FIntVector StartRegion = FIntVector::ZeroValue;
+    TObjectKey<AActor> Goal;
+
+    bool operator==(const FPathRequestKey& Other) const {
+        return StartRegion == Other.StartRegion && Goal == Other.Goal;
+    }
+
+    friend uint32 GetTypeHash(const FPathRequestKey& Key) {
+        return HashCombine(GetTypeHash(Key.StartRegion), GetTypeHash(Key.Goal));
+    }
+};
+
+/**
+ * One path query and every controller waiting for its result.
+ */
+struct FPathRequestGroup {
+    /** Start of the query, from the first controller to ask */
+    FVector Start = FVector::ZeroVector;
+
+    TWeakObjectPtr<AActor> Goal;
+
+    /** Keyed rather than weak, so destroyed controllers can still be dropped from the lookup */
+    TArray<TObjectKey<ADDAIController>> Waiting;
+
+    /** Navigation agent of the first controller to ask, used for the query */
+    FNavAgentProperties AgentProperties;
+
+    /** Async query id once dispatched, 0 while queued */
+    uint32 QueryId = 0;
+};
+
+/**
+ * Collects enemy path requests and runs them as asynchronous navigation queries.
+ * Requests that start in the same region and head for the same goal share one query, and
+ * only a fixed number of queries are dispatched per frame, so a burst of re-paths - e.g.
+ * a knockback storm - is spread over frames instead of spiking a single one. Every waiting
+ * controller follows the query's path, which repaths itself when the navmesh changes.
+ */
+UCLASS()
+class DDKNOCKOFF_API UPathRequestManager : public UManagerBase, public IDebugInformationProvider {
+    GENERATED_BODY()
+
+public:
+    // ManagerBase Interface
+    virtual void Initialize() override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Dispatches after the AI director so this frame's requests can go out straight away */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
+
+    // Requests
+
+    /**
+     * Queue a path for a controller, replacing any request it already has pending.
+     * @param Controller - Controller to deliver the path to
+     * @param Start - Location to path from
+     * @param Goal - Actor to path to
+     * @param AgentProperties - Navigation agent to find the path for
+     */
+    void RequestPath(ADDAIController* Controller,
+                     const FVector& Start,
+                     AActor& Goal,
+                     const FNavAgentProperties& AgentProperties);
+
+    /**
+     * Drop a controller's pending request. Other controllers sharing the query still get it.
+     * @param Controller - Controller whose request to drop
+     */
+    void CancelRequest(const ADDAIController* Controller);
+
+    bool IsRequestPending(const ADDAIController* Controller) const;
+
+    /** Queries queued or in flight, after de-duplication */
+    int32 GetNumQueries() const { return Groups.Num(); }
+
+    int32 GetNumWaitingControllers() const { return ControllerRequests.Num(); }
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+private:
+    /**
+     * Dispatch queued queries until the per-frame or in-flight budget is spent.
+     */
+    void DispatchQueries();
+
+    /**
+     * Receive an async query's result and hand the path to every waiting controller.
+     */
+    void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+    FPathRequestKey MakeKey(const FVector& Start, const AActor& Goal) const;
+
+    // Configuration
+
+    /** Size of the regions whose requests to the same goal share a query */
+    static constexpr float StartRegionSize = 150.0f;
+
+    /** Queries dispatched per frame at most */
+    static constexpr int32 MaxQueriesPerFrame = 16;
+
+    /** Queries in flight at once at most */
+    static constexpr int32 MaxQueriesInFlight = 32;
+
+    // Request state
+
+    TMap<FPathRequestKey, FPathRequestGroup> Groups;
+
+    /** Groups not yet dispatched, oldest first */
+    TArray<FPathRequestKey> QueuedKeys;
+
+    /** Group each in-flight query belongs to */
+    TMap<uint32, FPathRequestKey> InFlightQueries;
+
+    /** Group each waiting controller belongs to */
+    TMap<TObjectKey<ADDAIController>, FPathRequestKey> ControllerRequests;
+
+    // Statistics
+
+    int32 LastDispatched = 0;
+    int32 TotalRequests = 0;
+    int32 TotalQueries = 0;
+};
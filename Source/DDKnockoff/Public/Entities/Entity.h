@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "FactionEnums.h"
 #include "EntityTypeEnums.h"
+#include "EntityHandle.h"
 #include "UObject/Interface.h"
 #include "Entity.generated.h"
 
@@ -51,6 +52,12 @@ public:
      */
     virtual EEntityType GetEntityType() const = 0;
 
+    /**
+     * Get the registry handle issued to this entity by the entity manager.
+     * @return Entity handle, or a null handle if the entity is not registered
+     */
+    FEntityHandle GetEntityHandle() const;
+
     // Combat and interaction (optional implementations)
 
     /**
@@ -78,6 +85,15 @@ public:
      */
     virtual float GetHalfHeight() const { return 0.0f; }
 
+    // Level reset (optional implementation)
+
+    /**
+     * Return to the state the entity started the level in, for an in-place level reset.
+     * Only called on entities that survive the reset - anything spawned during play is
+     * destroyed instead.
+     */
+    virtual void ResetEntity() {}
+
     // Animation callbacks (optional implementations)
 
     virtual void OnFireNotifyReceived(UAnimSequenceBase* Animation) {}
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Tuple.h"
+#include "Entities/EntityTypeEnums.h"
+#include "Entities/FactionEnums.h"
+
+class IEntity;
+class FEntityArchetypeBase;
+
+/**
+ * Generational reference to a row in an entity archetype.
+ * Stays valid while the row is moved around to keep chunks dense, and goes stale once the row
+ * is removed.
+ */
+struct FArchetypeRowHandle {
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FArchetypeRowHandle& Other) const {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+
+    bool operator!=(const FArchetypeRowHandle& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FArchetypeRowHandle& Row) {
+        return HashCombine(GetTypeHash(Row.Index), GetTypeHash(Row.Generation));
+    }
+};
+
+/**
+ * Spawns a full entity standing in for an archetype row, e.g. an actor for a pickup the player
+ * touched or an enemy that came into view. Called with the row still present so its fragments
+ * can be copied; the row is removed once a proxy is returned.
+ */
+using FArchetypeProxyFactory = TFunction<IEntity*(UWorld& World,
+                                                  FEntityArchetypeBase& Archetype,
+                                                  const FArchetypeRowHandle& Row)>;
+
+/**
+ * Type-erased base for archetype storage, letting the entity manager own, count and
+ * materialize archetypes without knowing their fragment types.
+ */
+class DDKNOCKOFF_API FEntityArchetypeBase {
+public:
+    FEntityArchetypeBase(const FName InName, const EFaction InFaction, const EEntityType InType)
+        : Name(InName), Faction(InFaction), Type(InType) {}
+
+    virtual ~FEntityArchetypeBase() = default;
+
+    FName GetName() const { return Name; }
+    EFaction GetFaction() const { return Faction; }
+    EEntityType GetType() const { return Type; }
+
+    virtual int32 Num() const = 0;
+    virtual int32 NumChunks() const = 0;
+
+    /**
+     * Check whether a row handle still refers to a live row.
+     * @param Row - Row handle to validate
+     * @return true if the row has not been removed
+     */
+    virtual bool IsRowValid(const FArchetypeRowHandle& Row) const = 0;
+
+    /**
+     * Remove a row, filling its place from the end of the archetype so chunks stay dense.
+     * Never call while iterating chunks - collect rows and remove them afterwards.
+     * @param Row - Row to remove
+     * @return true if the row was live and has been removed
+     */
+    virtual bool RemoveRow(const FArchetypeRowHandle& Row) = 0;
+
+    virtual void Reset() = 0;
+
+    // Proxies
+
+    void SetProxyFactory(FArchetypeProxyFactory InProxyFactory) {
+        ProxyFactory = MoveTemp(InProxyFactory);
+    }
+
+    const FArchetypeProxyFactory& GetProxyFactory() const { return ProxyFactory; }
+
+protected:
+    FName Name;
+    EFaction Faction;
+    EEntityType Type;
+    FArchetypeProxyFactory ProxyFactory;
+};
+
+/**
+ * Chunked column storage for lightweight entities that share one set of fragment types.
+ * Each chunk stores up to ChunkCapacity rows with one contiguous array per fragment type, so
+ * batch systems stream through a single field at a time without touching actors or UObjects.
+ * Fragment types must be distinct, movable structs.
+ */
+template <typename... FragmentTypes>
+class TEntityArchetype final : public FEntityArchetypeBase {
+public:
+    static constexpr int32 ChunkCapacity = 128;
+
+    using FEntityArchetypeBase::FEntityArchetypeBase;
+
+    /**
+     * Append a row.
+     * @param Fragments - Initial fragment values, one per fragment type
+     * @return Handle to the new row
+     */
+    FArchetypeRowHandle AddRow(FragmentTypes... Fragments);
+
+    /**
+     * Get one fragment of a row.
+     * @param Row - Row handle
+     * @return Fragment, or null if the row has been removed
+     */
+    template <typename FragmentType>
+    FragmentType* GetFragment(const FArchetypeRowHandle& Row);
+
+    template <typename FragmentType>
+    const FragmentType* GetFragment(const FArchetypeRowHandle& Row) const;
+
+    /**
+     * Run a batch function over every chunk.
+     * @param Function - Called as Function(Rows, Fragments...) with a view per fragment column,
+     *                   all the same length as Rows
+     */
+    template <typename FunctionType>
+    void ForEachChunk(FunctionType&& Function);
+
+    // FEntityArchetypeBase Interface
+    virtual int32 Num() const override { return RowCount; }
+    virtual int32 NumChunks() const override { return Chunks.Num(); }
+    virtual bool IsRowValid(const FArchetypeRowHandle& Row) const override;
+    virtual bool RemoveRow(const FArchetypeRowHandle& Row) override;
+    virtual void Reset() override;
+
+private:
+    struct FChunk {
+        TTuple<TArray<FragmentTypes>...> Columns;
+        TArray<FArchetypeRowHandle> Rows;
+
+        FChunk() {
+            Rows.Reserve(ChunkCapacity);
+            VisitTupleElements([](auto& Column) { Column.Reserve(ChunkCapacity); }, Columns);
+        }
+
+        int32 Num() const { return Rows.Num(); }
+    };
+
+    /** Where a row currently lives; free entries are chained through NextFreeRow */
+    struct FRowLocation {
+        int32 ChunkIndex = INDEX_NONE;
+        int32 IndexInChunk = INDEX_NONE;
+        uint32 Generation = 1;
+        int32 NextFreeRow = INDEX_NONE;
+    };
+
+    template <typename FragmentType>
+    static TArray<FragmentType>& GetColumn(FChunk& Chunk) {
+        return Chunk.Columns.template Get<TTupleIndex<TArray<FragmentType>,
+                                                      TTuple<TArray<FragmentTypes>...>>::Value>();
+    }
+
+    template <typename FragmentType>
+    static const TArray<FragmentType>& GetColumn(const FChunk& Chunk) {
+        return Chunk.Columns.template Get<TTupleIndex<TArray<FragmentType>,
+                                                      TTuple<TArray<FragmentTypes>...>>::Value>();
+    }
+
+    int32 AllocateRow();
+
+    TArray<FChunk> Chunks;
+    TArray<FRowLocation> RowLocations;
+    int32 FirstFreeRow = INDEX_NONE;
+    int32 RowCount = 0;
+};
+
+template <typename... FragmentTypes>
+FArchetypeRowHandle TEntityArchetype<FragmentTypes...>::AddRow(FragmentTypes... Fragments) {
+    // Only the last chunk can have space, every other chunk is kept full
+    if (Chunks.IsEmpty() || Chunks.Last().Num() == ChunkCapacity) { Chunks.AddDefaulted(); }
+    FChunk& Chunk = Chunks.Last();
+
+    const int32 RowIndex = AllocateRow();
+    FRowLocation& Location = RowLocations[RowIndex];
+    Location.ChunkIndex = Chunks.Num() - 1;
+    Location.IndexInChunk = Chunk.Num();
+
+    const FArchetypeRowHandle Row{RowIndex, Location.Generation};
+    Chunk.Rows.Add(Row);
+    (GetColumn<FragmentTypes>(Chunk).Add(MoveTemp(Fragments)), ...);
+
+    ++RowCount;
+    return Row;
+}
+
+template <typename... FragmentTypes>
+template <typename FragmentType>
+FragmentType* TEntityArchetype<FragmentTypes...>::GetFragment(const FArchetypeRowHandle& Row) {
+    if (!IsRowValid(Row)) { return nullptr; }
+
+    const FRowLocation& Location = RowLocations[Row.Index];
+    return &GetColumn<FragmentType>(Chunks[Location.ChunkIndex])[Location.IndexInChunk];
+}
+
+template <typename... FragmentTypes>
+template <typename FragmentType>
+const FragmentType* TEntityArchetype<FragmentTypes...>::GetFragment(
+    const FArchetypeRowHandle& Row) const {
+    if (!IsRowValid(Row)) { return nullptr; }
+
+    const FRowLocation& Location = RowLocations[Row.Index];
+    return &GetColumn<FragmentType>(Chunks[Location.ChunkIndex])[Location.IndexInChunk];
+}
+
+template <typename... FragmentTypes>
+template <typename FunctionType>
+void TEntityArchetype<FragmentTypes...>::ForEachChunk(FunctionType&& Function) {
+    for (FChunk& Chunk : Chunks) {
+        Function(TConstArrayView<FArchetypeRowHandle>(Chunk.Rows),
+                 TArrayView<FragmentTypes>(GetColumn<FragmentTypes>(Chunk))...);
+    }
+}
+
+template <typename... FragmentTypes>
+bool TEntityArchetype<FragmentTypes...>::IsRowValid(const FArchetypeRowHandle& Row) const {
+    return RowLocations.IsValidIndex(Row.Index)
+           && RowLocations[Row.Index].ChunkIndex != INDEX_NONE
+           && RowLocations[Row.Index].Generation == Row.Generation;
+}
+
+template <typename... FragmentTypes>
+bool TEntityArchetype<FragmentTypes...>::RemoveRow(const FArchetypeRowHandle& Row) {
+    if (!IsRowValid(Row)) { return false; }
+
+    FRowLocation& Location = RowLocations[Row.Index];
+    FChunk& Chunk = Chunks[Location.ChunkIndex];
+    FChunk& LastChunk = Chunks.Last();
+    const int32 LastIndexInChunk = LastChunk.Num() - 1;
+
+    // Fill the hole with the archetype's final row so every chunk but the last stays full
+    if (&Chunk != &LastChunk || Location.IndexInChunk != LastIndexInChunk) {
+        const int32 HoleIndex = Location.IndexInChunk;
+        VisitTupleElements([HoleIndex, LastIndexInChunk](auto& ToColumn, auto& FromColumn) {
+                               ToColumn[HoleIndex] = MoveTemp(FromColumn[LastIndexInChunk]);
+                           },
+                           Chunk.Columns,
+                           LastChunk.Columns);
+
+        const FArchetypeRowHandle MovedRow = LastChunk.Rows[LastIndexInChunk];
+        Chunk.Rows[HoleIndex] = MovedRow;
+        RowLocations[MovedRow.Index].ChunkIndex = Location.ChunkIndex;
+        RowLocations[MovedRow.Index].IndexInChunk = HoleIndex;
+    }
+
+    VisitTupleElements([](auto& Column) { Column.Pop(EAllowShrinking::No); }, LastChunk.Columns);
+    LastChunk.Rows.Pop(EAllowShrinking::No);
+    if (LastChunk.Num() == 0) { Chunks.Pop(EAllowShrinking::No); }
+
+    // Release the row, skipping generation zero on wrap-around
+    Location.ChunkIndex = INDEX_NONE;
+    Location.IndexInChunk = INDEX_NONE;
+    Location.Generation = Location.Generation + 1 == 0 ? 1 : Location.Generation + 1;
+    Location.NextFreeRow = FirstFreeRow;
+    FirstFreeRow = Row.Index;
+
+    --RowCount;
+    return true;
+}
+
+template <typename... FragmentTypes>
+void TEntityArchetype<FragmentTypes...>::Reset() {
+    Chunks.Reset();
+
+    // Keep generations so handles from before the reset stay stale
+    FirstFreeRow = INDEX_NONE;
+    for (int32 RowIndex = RowLocations.Num() - 1; RowIndex >= 0; --RowIndex) {
+        FRowLocation& Location = RowLocations[RowIndex];
+        if (Location.ChunkIndex != INDEX_NONE) {
+            Location.ChunkIndex = INDEX_NONE;
+            Location.IndexInChunk = INDEX_NONE;
+            Location.Generation = Location.Generation + 1 == 0 ? 1 : Location.Generation + 1;
+        }
+        Location.NextFreeRow = FirstFreeRow;
+        FirstFreeRow = RowIndex;
+    }
+
+    RowCount = 0;
+}
+
+template <typename... FragmentTypes>
+int32 TEntityArchetype<FragmentTypes...>::AllocateRow() {
+    if (FirstFreeRow != INDEX_NONE) {
+        const int32 RowIndex = FirstFreeRow;
+        FirstFreeRow = RowLocations[RowIndex].NextFreeRow;
+        RowLocations[RowIndex].NextFreeRow = INDEX_NONE;
+        return RowIndex;
+    }
+
+    return RowLocations.AddDefaulted();
+}
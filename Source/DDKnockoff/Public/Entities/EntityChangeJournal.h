@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Entities/EntityHandle.h"
+#include "Entities/EntityTypeEnums.h"
+#include "Entities/FactionEnums.h"
+#include "EntityChangeJournal.generated.h"
+
+/**
+ * Kinds of change recorded in the entity manager's change journal.
+ * Values are bit flags so filters can select several kinds at once.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EEntityChangeType : uint8 {
+    None = 0 UMETA(Hidden),
+    Added = 1 << 0 UMETA(DisplayName = "Added"),
+    Removed = 1 << 1 UMETA(DisplayName = "Removed"),
+    MovedBucket = 1 << 2 UMETA(DisplayName = "Moved Bucket"),
+    TargetabilityChanged = 1 << 3 UMETA(DisplayName = "Targetability Changed"),
+    All = Added | Removed | MovedBucket | TargetabilityChanged UMETA(Hidden)
+};
+
+ENUM_CLASS_FLAGS(EEntityChangeType);
+
+/**
+ * Single entry in the change journal.
+ * Carries the bucket keys at the time of the change so subscribers never need to touch the
+ * (possibly destroyed) entity.
+ */
+USTRUCT(BlueprintType)
+struct FEntityChangeRecord {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EEntityChangeType ChangeType = EEntityChangeType::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    FEntityHandle Handle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EFaction Faction = EFaction::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EEntityType Type = EEntityType::None;
+
+    /** Bucket keys before the change, only differs from Faction/Type for MovedBucket records */
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EFaction PreviousFaction = EFaction::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EEntityType PreviousType = EEntityType::None;
+
+    /** Targetability after the change */
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    bool bTargetable = false;
+};
+
+/**
+ * Selects which journal records a subscriber is woken for.
+ * MovedBucket records match if either the previous or the new bucket keys match.
+ */
+struct FEntityChangeFilter {
+    /** Change kinds to deliver */
+    EEntityChangeType ChangeTypes = EEntityChangeType::All;
+
+    /** Faction to match, EFaction::None matches any faction */
+    EFaction Faction = EFaction::None;
+
+    /** Type to match, EEntityType::None matches any type */
+    EEntityType Type = EEntityType::None;
+
+    bool Matches(const FEntityChangeRecord& Record) const {
+        if (!EnumHasAnyFlags(ChangeTypes, Record.ChangeType)) { return false; }
+        return MatchesKeys(Record.Faction, Record.Type)
+               || (Record.ChangeType == EEntityChangeType::MovedBucket
+                   && MatchesKeys(Record.PreviousFaction, Record.PreviousType));
+    }
+
+private:
+    bool MatchesKeys(const EFaction InFaction, const EEntityType InType) const {
+        return (Faction == EFaction::None || InFaction == Faction)
+               && (Type == EEntityType::None || InType == Type);
+    }
+};
+
+/** Receives the journal records matching a subscription, once per frame when there are any */
+DECLARE_DELEGATE_OneParam(FOnEntityChangesDelegate, TConstArrayView<FEntityChangeRecord>);
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "Entities/EntityHandle.h"
 #include "EntityData.generated.h"
 
 /**
@@ -26,7 +27,22 @@ public:
      */
     void InitialiseID();
 
+    /**
+     * Get the registry handle assigned by the entity manager.
+     * @return Handle for O(1) lookups, or a null handle if not registered
+     */
+    FEntityHandle GetHandle() const { return Handle; }
+
+    /**
+     * Store the registry handle for this entity. Managed by UEntityManager.
+     * @param InHandle - Handle issued on registration, or a null handle on unregistration
+     */
+    void SetHandle(const FEntityHandle InHandle) { Handle = InHandle; }
+
 private:
     UPROPERTY(Transient)
     FGuid ID;
+
+    UPROPERTY(Transient)
+    FEntityHandle Handle;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EntityHandle.generated.h"
+
+/**
+ * Compact generational reference to an entity registered with the entity manager.
+ * Packs a registry slot index and a generation counter into 32 bits, so it resolves in O(1)
+ * without hashing and can be cheaply detected as stale once the entity has been unregistered.
+ * Safe to store in AI, damage and projectile code in place of weak actor pointers.
+ */
+USTRUCT(BlueprintType)
+struct DDKNOCKOFF_API FEntityHandle {
+    GENERATED_BODY()
+
+    static constexpr uint32 IndexBits = 20;
+    static constexpr uint32 GenerationBits = 12;
+    static constexpr uint32 IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32 GenerationMask = (1u << GenerationBits) - 1;
+
+    /** Highest slot index a handle can address */
+    static constexpr uint32 MaxIndex = IndexMask;
+
+    FEntityHandle() = default;
+
+    FEntityHandle(const uint32 InIndex, const uint32 InGeneration)
+        : Value(((InGeneration & GenerationMask) << IndexBits) | (InIndex & IndexMask)) {}
+
+    /**
+     * Check if this handle was ever issued by the entity manager.
+     * Does not guarantee the entity is still alive - resolve through the manager for that.
+     * @return true if the handle is non-null
+     */
+    bool IsValid() const { return Value != 0; }
+
+    uint32 GetIndex() const { return Value & IndexMask; }
+    uint32 GetGeneration() const { return (Value >> IndexBits) & GenerationMask; }
+    uint32 GetValue() const { return Value; }
+
+    void Reset() { Value = 0; }
+
+    FString ToString() const {
+        return FString::Printf(TEXT("%u:%u"), GetIndex(), GetGeneration());
+    }
+
+    bool operator==(const FEntityHandle& Other) const { return Value == Other.Value; }
+    bool operator!=(const FEntityHandle& Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(const FEntityHandle& Handle) { return Handle.Value; }
+
+private:
+    // Generation zero is never issued, so a zeroed handle is always null
+    UPROPERTY()
+    uint32 Value = 0;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Entities/EntityHandle.h"
+#include "Entities/EntityTypeEnums.h"
+#include "Entities/FactionEnums.h"
+
+/**
+ * Criteria evaluated against the entity manager's hot data, without touching entity objects.
+ * Default-constructed filters match every live entity.
+ */
+struct FEntityQueryFilter {
+    /** Faction to match, EFaction::None matches any faction */
+    EFaction Faction = EFaction::None;
+
+    /** Faction to reject, EFaction::None rejects nothing */
+    EFaction ExcludedFaction = EFaction::None;
+
+    /** Type to match, EEntityType::None matches any type */
+    EEntityType Type = EEntityType::None;
+
+    /** Only match entities that are currently targetable */
+    bool bTargetableOnly = false;
+};
+
+/**
+ * Dense structure-of-arrays copy of the fields gameplay loops read most often.
+ * Every array shares one index per registered entity, matching the order of
+ * UEntityManager::GetAllEntities, so systems can scan a single field linearly without
+ * touching the entity objects. Owned and kept packed by the entity manager.
+ */
+struct DDKNOCKOFF_API FEntityHotData {
+    TArray<FEntityHandle> Handles;
+    TArray<EFaction> Factions;
+    TArray<EEntityType> Types;
+    TArray<FVector> Positions;
+    TArray<float> Health;
+    TBitArray<> Targetable;
+
+    int32 Num() const { return Handles.Num(); }
+
+    SIZE_T GetAllocatedSize() const {
+        return Handles.GetAllocatedSize() + Factions.GetAllocatedSize() + Types.GetAllocatedSize()
+               + Positions.GetAllocatedSize() + Health.GetAllocatedSize()
+               + Targetable.GetAllocatedSize();
+    }
+
+    /**
+     * Append an entity's fields.
+     * @return Index of the new entry
+     */
+    int32 Add(const FEntityHandle Handle,
+              const EFaction Faction,
+              const EEntityType Type,
+              const FVector& Position,
+              const float InHealth,
+              const bool bTargetable) {
+        Factions.Add(Faction);
+        Types.Add(Type);
+        Positions.Add(Position);
+        Health.Add(InHealth);
+        Targetable.Add(bTargetable);
+        return Handles.Add(Handle);
+    }
+
+    /**
+     * Remove an entry by moving the last entry into its place, matching the bucket swap-removal.
+     * @param Index - Entry to remove
+     */
+    void RemoveAtSwap(const int32 Index) {
+        const int32 LastIndex = Num() - 1;
+        if (Index != LastIndex) { Targetable[Index] = Targetable[LastIndex]; }
+        Targetable.RemoveAt(LastIndex);
+
+        Handles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        Factions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        Types.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        Health.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+
+    void Reset() {
+        Handles.Reset();
+        Factions.Reset();
+        Types.Reset();
+        Positions.Reset();
+        Health.Reset();
+        Targetable.Reset();
+    }
+
+    /**
+     * Check whether an entry passes a query filter.
+     * @param Index - Entry to test
+     * @param Filter - Criteria to evaluate
+     * @return true if every criterion matches
+     */
+    bool Matches(const int32 Index, const FEntityQueryFilter& Filter) const {
+        const EFaction Faction = Factions[Index];
+        const EEntityType Type = Types[Index];
+        return (Filter.Faction == EFaction::None || Faction == Filter.Faction)
+               && (Filter.ExcludedFaction == EFaction::None || Faction != Filter.ExcludedFaction)
+               && (Filter.Type == EEntityType::None || Type == Filter.Type)
+               && (!Filter.bTargetableOnly || Targetable[Index]);
+    }
+};
@@ -1,15 +1,25 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
 #include "Core/ManagerBase.h"
+#include "Debug/DebugInformationProvider.h"
 #include "UObject/Object.h"
 #include "Entities/Entity.h"
+#include "Entities/EntityArchetype.h"
+#include "Entities/EntityChangeJournal.h"
+#include "Entities/EntityHandle.h"
+#include "Entities/EntityHotData.h"
+#include "Entities/EntityRegistrySnapshot.h"
+#include "Entities/EntitySpatialHash.h"
+#include "Entities/EntityView.h"
 #include "EntityManager.generated.h"
 
 class IEntity;
 
 /**
  * Wrapper struct for array of entities to use in TMap collections.
+ * SlotIndices runs parallel to Entities so a swap-removal can patch the moved entity's slot.
  */
 USTRUCT()
 struct FEntityArray {
@@ -17,6 +27,12 @@ struct FEntityArray {
 
     UPROPERTY()
     TArray<TScriptInterface<IEntity>> Entities;
+
+    TArray<int32> SlotIndices;
+
+    SIZE_T GetAllocatedSize() const {
+        return Entities.GetAllocatedSize() + SlotIndices.GetAllocatedSize();
+    }
 };
 
 /**
@@ -48,12 +64,178 @@ struct FFactionTypeKey {
     }
 };
 
+/**
+ * Live and peak number of entities in one registry bucket.
+ */
+USTRUCT(BlueprintType)
+struct FEntityBucketCount {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    int32 Live = 0;
+
+    /** Highest Live has reached since the manager was initialized */
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    int32 HighWater = 0;
+
+    void Increment() {
+        ++Live;
+        HighWater = FMath::Max(HighWater, Live);
+    }
+
+    void Decrement() { --Live; }
+};
+
+/**
+ * Aggregate registry statistics, maintained incrementally on every registry change so game flow,
+ * the debug overlay and telemetry can read them without walking any entity collection.
+ */
+USTRUCT(BlueprintType)
+struct FEntityManagerStats {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    FEntityBucketCount All;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    TMap<EFaction, FEntityBucketCount> ByFaction;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    TMap<EEntityType, FEntityBucketCount> ByType;
+
+    UPROPERTY()
+    TMap<FFactionTypeKey, FEntityBucketCount> ByFactionAndType;
+
+    /** Successful registrations since the manager was initialized */
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    int32 TotalRegistered = 0;
+
+    /** Unregistrations since the manager was initialized */
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    int32 TotalUnregistered = 0;
+
+    FEntityBucketCount GetFactionCount(const EFaction Faction) const {
+        return ByFaction.FindRef(Faction);
+    }
+
+    FEntityBucketCount GetTypeCount(const EEntityType Type) const { return ByType.FindRef(Type); }
+
+    FEntityBucketCount GetFactionAndTypeCount(const EFaction Faction, const EEntityType Type) const {
+        return ByFactionAndType.FindRef(FFactionTypeKey(Faction, Type));
+    }
+
+    /**
+     * Count an entity into every bucket it belongs to.
+     * @param Faction - Entity faction
+     * @param Type - Entity type
+     */
+    void AddToBuckets(const EFaction Faction, const EEntityType Type) {
+        All.Increment();
+        ByFaction.FindOrAdd(Faction).Increment();
+        ByType.FindOrAdd(Type).Increment();
+        ByFactionAndType.FindOrAdd(FFactionTypeKey(Faction, Type)).Increment();
+    }
+
+    /**
+     * Count an entity out of every bucket it belongs to.
+     * @param Faction - Entity faction
+     * @param Type - Entity type
+     */
+    void RemoveFromBuckets(const EFaction Faction, const EEntityType Type) {
+        All.Decrement();
+        ByFaction.FindChecked(Faction).Decrement();
+        ByType.FindChecked(Type).Decrement();
+        ByFactionAndType.FindChecked(FFactionTypeKey(Faction, Type)).Decrement();
+    }
+};
+
+/**
+ * Registry slot holding a single entity and the generation used to validate handles to it.
+ * Free slots are chained through NextFreeSlot so they can be reused without scanning.
+ */
+USTRUCT()
+struct FEntitySlot {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TScriptInterface<IEntity> Entity;
+
+    /** Incremented whenever the slot is released, invalidating outstanding handles */
+    uint32 Generation = 1;
+
+    /** Index of the next free slot while this slot is on the free list, INDEX_NONE otherwise */
+    int32 NextFreeSlot = INDEX_NONE;
+
+    /** Held until the slot is released, even once garbage collection has nulled the entity */
+    bool bOccupied = false;
+
+    // Bucket keys cached at registration so removal does not depend on the entity's current state
+    EFaction Faction = EFaction::None;
+    EEntityType Type = EEntityType::None;
+
+    // Position of the entity within each bucket, kept up to date across swap-removals
+    int32 AllEntitiesIndex = INDEX_NONE;
+    int32 FactionIndex = INDEX_NONE;
+    int32 TypeIndex = INDEX_NONE;
+    int32 FactionAndTypeIndex = INDEX_NONE;
+
+    // Component whose movement keeps the spatial hash up to date, if the entity has an actor
+    TWeakObjectPtr<USceneComponent> TrackedComponent;
+    FDelegateHandle TransformUpdatedHandle;
+};
+
+/**
+ * Summary of an entity removed from the registry, delivered in batches once per frame.
+ * Carries the bucket keys so listeners never need to touch the (possibly destroyed) entity.
+ */
+USTRUCT(BlueprintType)
+struct FEntityRemovalRecord {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    FEntityHandle Handle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EFaction Faction = EFaction::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Entity Management")
+    EEntityType Type = EEntityType::None;
+};
+
+/**
+ * Registration or unregistration waiting for the end-of-frame commit.
+ */
+USTRUCT()
+struct FPendingEntityOperation {
+    GENERATED_BODY()
+
+    /** Entity to register, may be nulled by garbage collection before the commit */
+    UPROPERTY()
+    TScriptInterface<IEntity> Entity;
+
+    /** Slot to release for unregistrations, which never need the entity itself */
+    FEntityHandle Handle;
+
+    bool bRegister = true;
+};
+
+/**
+ * Native subscriber to the change journal.
+ */
+struct FEntityChangeSubscription {
+    FDelegateHandle Handle;
+    FEntityChangeFilter Filter;
+    FOnEntityChangesDelegate Delegate;
+};
+
 /**
  * Central manager for tracking and organizing all entities in the game world.
  * Provides efficient lookup by faction, type, and composite keys for AI and gameplay systems.
+ * Gameplay actors queue their registration changes, which are committed together once per frame
+ * so containers stay stable while systems iterate them.
  */
 UCLASS()
-class DDKNOCKOFF_API UEntityManager : public UManagerBase {
+class DDKNOCKOFF_API UEntityManager : public UManagerBase, public IDebugInformationProvider {
     GENERATED_BODY()
 
 public:
@@ -62,22 +244,63 @@ public:
     // ManagerBase Interface
     virtual void Initialize() override;
     virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
 
     // Events
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEntityRemovedSignature,
                                                 const TScriptInterface<IEntity>&,
                                                 Entity);
 
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEntitiesRemovedSignature,
+                                                const TArray<FEntityRemovalRecord>&,
+                                                RemovedEntities);
+
+    /** Fired immediately for each entity as it is unregistered */
     UPROPERTY(BlueprintAssignable, Category = "Entity Management")
     FOnEntityRemovedSignature OnEntityRemoved;
 
+    /** Fired once per frame with every entity unregistered since the previous commit */
+    UPROPERTY(BlueprintAssignable, Category = "Entity Management")
+    FOnEntitiesRemovedSignature OnEntitiesRemoved;
+
+    // Change journal
+
+    /**
+     * Subscribe to journal records matching a filter.
+     * Matching records are delivered in one batch per frame, after pending operations are
+     * committed, and only if at least one record matched. Subscriptions outlive a manager
+     * refresh, after which every registered entity is recorded as added again.
+     * @param Filter - Selects the change kinds and bucket keys to deliver
+     * @param Delegate - Called with the matching records
+     * @return Handle for unsubscribing
+     */
+    FDelegateHandle SubscribeToChanges(const FEntityChangeFilter& Filter,
+                                       FOnEntityChangesDelegate Delegate);
+
+    /**
+     * Remove a journal subscription. Safe to call from within a change callback.
+     * @param Handle - Handle returned by SubscribeToChanges
+     */
+    void UnsubscribeFromChanges(FDelegateHandle Handle);
+
+    /**
+     * Deliver every journal record written since the last dispatch to matching subscribers.
+     * Called from Tick; records written by subscribers are delivered on the next dispatch.
+     */
+    void DispatchChangeJournal();
+
     // Entity registration
 
     /**
-     * Register an entity with the manager for tracking and lookup.
+     * Register an entity with the manager for tracking and lookup. Registering an entity that is
+     * already registered is an error and leaves it as it was.
      * @param Entity - Entity to register
+     * @return Handle issued to the entity, its existing handle if it was already registered, or a
+     * null handle if registration failed
      */
-    virtual void RegisterEntity(IEntity* Entity);
+    virtual FEntityHandle RegisterEntity(IEntity* Entity);
 
     /**
      * Unregister an entity from the manager and fire removal event.
@@ -85,16 +308,74 @@ public:
      */
     virtual void UnregisterEntity(IEntity* Entity);
 
+    // Deferred registration
+
+    /**
+     * Queue an entity for registration at the next commit.
+     * @param Entity - Entity to register
+     */
+    void QueueRegister(IEntity* Entity);
+
+    /**
+     * Queue an entity for unregistration at the next commit. The entity's handle is captured
+     * now, so the commit still releases it if the entity is garbage collected meanwhile.
+     * Cancels a still-pending registration of the same entity instead of queueing.
+     * @param Entity - Entity to unregister
+     */
+    void QueueUnregister(IEntity* Entity);
+
+    /**
+     * Apply all queued operations in order and broadcast the batched removal event. After a
+     * garbage collection, also releases the slots of entities that were collected without
+     * unregistering. Called from Tick; exposed so tests and phase transitions can force a commit.
+     */
+    void CommitPendingOperations();
+
+    bool HasPendingOperations() const { return !PendingOperations.IsEmpty(); }
+
+    // Handle resolution
+
+    /**
+     * Resolve a handle to its entity in O(1).
+     * @param Handle - Handle previously issued by RegisterEntity
+     * @return Entity pointer, or null if the handle is null or stale
+     */
+    IEntity* ResolveEntity(const FEntityHandle& Handle) const;
+
+    /**
+     * Resolve a handle to its entity interface reference.
+     * @param Handle - Handle previously issued by RegisterEntity
+     * @return Entity interface, or an empty interface if the handle is null or stale
+     */
+    TScriptInterface<IEntity> GetEntity(const FEntityHandle& Handle) const;
+
+    /**
+     * Resolve a handle directly to the entity's actor.
+     * @param Handle - Handle previously issued by RegisterEntity
+     * @return Actor for the entity, or null if the handle is null or stale
+     */
+    AActor* ResolveActor(const FEntityHandle& Handle) const;
+
+    /**
+     * Check whether a handle still refers to a registered entity.
+     * @param Handle - Handle to validate
+     * @return true if the handle's slot is occupied by the same generation
+     */
+    bool IsHandleValid(const FEntityHandle& Handle) const;
+
     // Entity queries
 
     /**
      * Get all registered entities in the world.
      * @return Array of all entities
      */
-    virtual const TArray<TScriptInterface<IEntity>>& GetAllEntities() const { return AllEntities; }
+    virtual const TArray<TScriptInterface<IEntity>>& GetAllEntities() const {
+        return AllEntities.Entities;
+    }
 
     /**
      * Find a specific entity by its unique identifier.
+     * Linear in the number of entities - prefer resolving an FEntityHandle in hot paths.
      * @param ID - Entity's unique ID
      * @return Entity interface or null if not found
      */
@@ -124,11 +405,357 @@ public:
         EFaction Faction,
         EEntityType Type) const;
 
+    // Zero-copy queries
+
+    /**
+     * View all entities belonging to a faction without copying.
+     * @param Faction - Target faction
+     * @return View valid until the next registration or unregistration
+     */
+    FEntityView ViewEntitiesByFaction(EFaction Faction) const;
+
+    /**
+     * View all entities of a type without copying.
+     * @param Type - Target entity type
+     * @return View valid until the next registration or unregistration
+     */
+    FEntityView ViewEntitiesByType(EEntityType Type) const;
+
+    /**
+     * View entities matching both faction and type without copying.
+     * @param Faction - Target faction
+     * @param Type - Target entity type
+     * @return View valid until the next registration or unregistration
+     */
+    FEntityView ViewEntitiesByFactionAndType(EFaction Faction, EEntityType Type) const;
+
+    // Counts
+
+    int32 CountByFaction(EFaction Faction) const;
+    int32 CountByType(EEntityType Type) const;
+    int32 CountByFactionAndType(EFaction Faction, EEntityType Type) const;
+
+    // Statistics
+
+    /**
+     * Get live counts, high-water marks and lifetime totals for the registry.
+     * @return Statistics kept up to date on every registration change
+     */
+    const FEntityManagerStats& GetStats() const { return Stats; }
+
+    /**
+     * Check that every bucket entry's slot records that entry's position, and that the hot
+     * data follows the all entities bucket. Swap-removals patch these positions instead of
+     * searching, so a broken index would make later removals drop the wrong entity.
+     * @return true if every stored bucket index points back at its slot
+     */
+    bool AreBucketIndicesConsistentForTesting() const;
+
+    // IDebugInformationProvider Interface Implementation
+    virtual FString GetDebugCategory() const override;
+    virtual FString GetDebugInformation() const override;
+
+    // Hot data
+
+    /**
+     * Get the dense per-entity hot fields for linear iteration.
+     * @return Hot data, indexed the same as GetAllEntities
+     */
+    const FEntityHotData& GetHotData() const { return HotData; }
+
+    /**
+     * Get an entity's index into the hot data arrays.
+     * @param Handle - Entity handle
+     * @return Hot data index, or INDEX_NONE if the handle does not resolve
+     */
+    int32 GetHotIndex(const FEntityHandle& Handle) const;
+
+    /**
+     * Push an entity's targetability into the hot data. Called by the owning actor on change.
+     * @param Handle - Entity handle
+     * @param bTargetable - Whether the entity can currently be targeted
+     */
+    void SetEntityTargetable(const FEntityHandle& Handle, bool bTargetable);
+
+    /**
+     * Push an entity's current health into the hot data. Called by the owning actor on change.
+     * @param Handle - Entity handle
+     * @param Health - Current health value
+     */
+    void SetEntityHealth(const FEntityHandle& Handle, float Health);
+
+    /**
+     * Re-read an entity's faction and type and move it between buckets if either changed.
+     * Called by the owning actor after changing sides or type.
+     * @param Handle - Entity handle
+     */
+    void RefreshEntityBuckets(const FEntityHandle& Handle);
+
+    // Snapshots
+
+    /**
+     * Get a read-only snapshot of the registry for this frame, published from the live hot data
+     * by the first call after each tick so frames nobody asks for copy nothing.
+     * Call on the game thread and hand the pointer to worker tasks - the snapshot itself is
+     * immutable and safe to read from any thread for as long as the pointer is held.
+     * @return Latest snapshot, never null once the manager is initialized
+     */
+    FEntityRegistrySnapshotPtr GetSnapshot() const;
+
+    // Archetypes
+
+    /**
+     * Create chunked storage for lightweight entities that do not need an actor of their own.
+     * Rows are not registered entities - they have no handle, do not appear in buckets or
+     * queries, and are processed by archetype systems until materialized into a proxy.
+     * @param Name - Unique archetype name
+     * @param Faction - Faction of every row, used for counts and proxies
+     * @param Type - Entity type of every row, used for counts and proxies
+     * @return The new archetype, owned by the manager. Its rows are dropped on Deinitialize
+     */
+    template <typename... FragmentTypes>
+    TEntityArchetype<FragmentTypes...>& CreateArchetype(FName Name,
+                                                        EFaction Faction,
+                                                        EEntityType Type);
+
+    /**
+     * Find an archetype by name.
+     * @param Name - Archetype name
+     * @return Archetype, or null if none was created with that name
+     */
+    FEntityArchetypeBase* FindArchetype(FName Name) const;
+
+    /**
+     * Count archetype rows across every archetype with a given faction and type.
+     * @param Faction - Target faction
+     * @param Type - Target entity type
+     * @return Number of matching rows
+     */
+    int32 CountArchetypeRows(EFaction Faction, EEntityType Type) const;
+
+    /**
+     * Add a batch system run from Tick, in registration order, after pending operations are
+     * committed. Systems typically iterate an archetype's chunks. Systems registered or
+     * unregistered by a running system take effect once every system has run this frame.
+     * @param Name - Unique system name
+     * @param System - Called with the frame's delta time
+     */
+    void RegisterArchetypeSystem(FName Name, TFunction<void(float)> System);
+
+    /**
+     * Remove a batch system, deferred until the end of the frame's systems if one is running.
+     * @param Name - Name the system was registered under
+     */
+    void UnregisterArchetypeSystem(FName Name);
+
+    /**
+     * Replace an archetype row with a full entity using the archetype's proxy factory.
+     * The row is removed once the factory returns a proxy.
+     * @param ArchetypeName - Archetype holding the row
+     * @param Row - Row to materialize
+     * @return Proxy entity, or null if the row is stale or the archetype has no factory
+     */
+    IEntity* MaterializeProxy(FName ArchetypeName, const FArchetypeRowHandle& Row);
+
+    // Spatial queries
+
+    /**
+     * Find all entities within a radius of a point using the spatial hash.
+     * @param Faction - Faction to match, EFaction::None matches any faction
+     * @param Type - Type to match, EEntityType::None matches any type
+     * @param Center - Query center
+     * @param Radius - Query radius
+     * @param OutHandles - Receives handles of matching entities, in no particular order
+     */
+    void QueryRadius(EFaction Faction,
+                     EEntityType Type,
+                     const FVector& Center,
+                     float Radius,
+                     TArray<FEntityHandle>& OutHandles) const;
+
+    /**
+     * Find all entities within a radius of a point that pass a hot data filter.
+     * @param Filter - Criteria evaluated against the hot data
+     * @param Center - Query center
+     * @param Radius - Query radius
+     * @param OutHandles - Receives handles of matching entities, in no particular order
+     */
+    void QueryRadius(const FEntityQueryFilter& Filter,
+                     const FVector& Center,
+                     float Radius,
+                     TArray<FEntityHandle>& OutHandles) const;
+
+    /**
+     * Find all entities within a radius of a point that pass a custom filter.
+     * @param Center - Query center
+     * @param Radius - Query radius
+     * @param Filter - Returns true for entities to include
+     * @param OutHandles - Receives handles of matching entities, in no particular order
+     */
+    void QueryRadius(const FVector& Center,
+                     float Radius,
+                     TFunctionRef<bool(IEntity&)> Filter,
+                     TArray<FEntityHandle>& OutHandles) const;
+
+    /**
+     * Find the entities nearest to a point using the spatial hash.
+     * @param Faction - Faction to match, EFaction::None matches any faction
+     * @param Type - Type to match, EEntityType::None matches any type
+     * @param Center - Query center
+     * @param Count - Maximum number of entities to return
+     * @param OutHandles - Receives handles of the nearest matching entities, nearest first
+     * @param MaxRadius - Entities further than this are ignored
+     */
+    void FindNearest(EFaction Faction,
+                     EEntityType Type,
+                     const FVector& Center,
+                     int32 Count,
+                     TArray<FEntityHandle>& OutHandles,
+                     float MaxRadius = FLT_MAX) const;
+
+    /**
+     * Find the entities nearest to a point that pass a hot data filter.
+     * @param Filter - Criteria evaluated against the hot data
+     * @param Center - Query center
+     * @param Count - Maximum number of entities to return
+     * @param OutHandles - Receives handles of the nearest matching entities, nearest first
+     * @param MaxRadius - Entities further than this are ignored
+     */
+    void FindNearest(const FEntityQueryFilter& Filter,
+                     const FVector& Center,
+                     int32 Count,
+                     TArray<FEntityHandle>& OutHandles,
+                     float MaxRadius = FLT_MAX) const;
+
+    /**
+     * Find the entities nearest to a point that pass a custom filter.
+     * @param Center - Query center
+     * @param Count - Maximum number of entities to return
+     * @param Filter - Returns true for entities to include
+     * @param OutHandles - Receives handles of the nearest matching entities, nearest first
+     * @param MaxRadius - Entities further than this are ignored
+     */
+    void FindNearest(const FVector& Center,
+                     int32 Count,
+                     TFunctionRef<bool(IEntity&)> Filter,
+                     TArray<FEntityHandle>& OutHandles,
+                     float MaxRadius = FLT_MAX) const;
+
 private:
+    // Slot management
+
+    /**
+     * Take a slot from the free list, or grow the slot array if none are free.
+     * @return Index of the allocated slot, or INDEX_NONE if the handle index space is exhausted
+     */
+    int32 AllocateSlot();
+
+    /**
+     * Clear a slot, bump its generation and push it onto the free list.
+     * @param SlotIndex - Index of the slot to release
+     */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /**
+     * Find the slot a handle refers to, if its entity is registered and not pending destruction.
+     * @param Handle - Handle to look up
+     * @return Slot, or null if the handle is null, stale or its entity is being destroyed
+     */
+    const FEntitySlot* FindSlot(const FEntityHandle& Handle) const;
+
+    /**
+     * Find the slot a handle refers to, regardless of whether its entity is being destroyed or
+     * has already been garbage collected.
+     * @param Handle - Handle to look up
+     * @return Slot, or null if the handle is null or stale
+     */
+    const FEntitySlot* FindOccupiedSlot(const FEntityHandle& Handle) const;
+
+    /**
+     * Remove an occupied slot's entity from every container and release the slot. Works from
+     * the slot's cached state alone, so the entity may already be gone.
+     * @param SlotIndex - Slot to release
+     */
+    void UnregisterSlot(int32 SlotIndex);
+
+    /**
+     * Release the slots of entities garbage collected without unregistering.
+     */
+    void ReleaseCollectedSlots();
+
+    void OnPostGarbageCollect() { bCollectedSinceCommit = true; }
+
+    /**
+     * Copy the current hot data into the back snapshot buffer and make it the published snapshot.
+     * Called by GetSnapshot once the published snapshot is out of date.
+     */
+    void PublishSnapshot() const;
+
+    // Bucket maintenance
+
+    /**
+     * Append a slot's entity to a bucket.
+     * @param Bucket - Bucket to append to
+     * @param SlotIndex - Slot holding the entity
+     * @return Position of the entity within the bucket
+     */
+    int32 AddToBucket(FEntityArray& Bucket, int32 SlotIndex) const;
+
+    /**
+     * Remove an entry from a bucket in O(1) by swapping the last entry into its place.
+     * @param Bucket - Bucket to remove from
+     * @param BucketIndex - Position of the entry to remove
+     * @param SlotBucketIndex - Slot member tracking positions in this bucket, patched for the moved entry
+     */
+    void RemoveFromBucket(FEntityArray& Bucket,
+                          int32 BucketIndex,
+                          int32 FEntitySlot::* SlotBucketIndex);
+
+    FEntityView MakeView(const FEntityArray* Bucket) const;
+
+    // Spatial tracking
+
+    /**
+     * Insert an entity's actor into the spatial hash and follow its root component's movement.
+     * @param SlotIndex - Slot holding the entity
+     */
+    void StartSpatialTracking(int32 SlotIndex);
+
+    /**
+     * Remove an entity from the spatial hash and stop following its movement.
+     * @param SlotIndex - Slot holding the entity
+     */
+    void StopSpatialTracking(int32 SlotIndex);
+
+    void OnTrackedComponentMoved(USceneComponent* Component,
+                                 EUpdateTransformFlags UpdateTransformFlags,
+                                 ETeleportType Teleport,
+                                 int32 SlotIndex);
+
+    bool IsSlotLive(int32 SlotIndex) const;
+    bool SlotMatches(int32 SlotIndex, const FEntityQueryFilter& Filter) const;
+
+    FEntityHandle MakeHandle(int32 SlotIndex) const;
+
+    /**
+     * Append a record to the change journal, filled from the slot's current state.
+     * @param ChangeType - Kind of change
+     * @param SlotIndex - Slot holding the changed entity
+     * @return The new record, for callers that need to amend it
+     */
+    FEntityChangeRecord& RecordChange(EEntityChangeType ChangeType, int32 SlotIndex);
+
+    /**
+     * Apply the system registrations and unregistrations made while the systems were running.
+     */
+    void ApplyPendingArchetypeSystemChanges();
+
     // Entity storage and lookup tables
 
     UPROPERTY(Transient)
-    TMap<FGuid, TScriptInterface<IEntity>> EntityMap;
+    TArray<FEntitySlot> Slots;
+
+    int32 FirstFreeSlot = INDEX_NONE;
 
     UPROPERTY(Transient)
     TMap<EFaction, FEntityArray> FactionMap;
@@ -140,5 +767,73 @@ private:
     TMap<FFactionTypeKey, FEntityArray> FactionAndTypeMap;
 
     UPROPERTY(Transient)
-    TArray<TScriptInterface<IEntity>> AllEntities;
+    FEntityArray AllEntities;
+
+    UPROPERTY(Transient)
+    FEntityManagerStats Stats;
+
+    // Deferred registration state
+
+    UPROPERTY(Transient)
+    TArray<FPendingEntityOperation> PendingOperations;
+
+    UPROPERTY(Transient)
+    TArray<FEntityRemovalRecord> PendingRemovalRecords;
+
+    /** Set by garbage collection, the next commit looks for collected entities */
+    bool bCollectedSinceCommit = false;
+
+    FDelegateHandle PostGarbageCollectHandle;
+
+    // Archetype storage, not reflected - rows hold plain structs only
+
+    TMap<FName, TSharedPtr<FEntityArchetypeBase>> Archetypes;
+    TArray<TPair<FName, TFunction<void(float)>>> ArchetypeSystems;
+
+    /** Registrations, or unregistrations with no function, made while the systems were running */
+    TArray<TPair<FName, TFunction<void(float)>>> PendingArchetypeSystemChanges;
+
+    bool bRunningArchetypeSystems = false;
+
+    // Change journal state
+
+    /** Records written since the last dispatch, in order */
+    TArray<FEntityChangeRecord> ChangeJournal;
+
+    TArray<FEntityChangeSubscription> ChangeSubscriptions;
+
+    /** Set while DispatchChangeJournal is running, so unsubscribing defers the removal */
+    bool bDispatchingChanges = false;
+
+    /** Hot fields of every registered entity, packed in AllEntities order */
+    FEntityHotData HotData;
+
+    /**
+     * Double-buffered snapshots. The back buffer's storage is reused when no reader still holds
+     * it, otherwise a fresh snapshot is allocated so outstanding readers are never disturbed.
+     */
+    mutable TSharedPtr<FEntityRegistrySnapshot, ESPMode::ThreadSafe> SnapshotBuffers[2];
+    mutable int32 PublishedSnapshotIndex = 0;
+    mutable uint64 SnapshotFrameCounter = 0;
+
+    /** The registry has ticked since the published snapshot was taken */
+    mutable bool bSnapshotDirty = true;
+
+    /** Positions of every registered entity that has an actor, keyed by slot index */
+    FEntitySpatialHash SpatialHash;
+
+    /** Bumped on every registry mutation so outstanding views can detect they are stale */
+    uint32 MutationSerial = 0;
 };
+
+template <typename... FragmentTypes>
+TEntityArchetype<FragmentTypes...>& UEntityManager::CreateArchetype(const FName Name,
+                                                                    const EFaction Faction,
+                                                                    const EEntityType Type) {
+    check(!Archetypes.Contains(Name));
+
+    const TSharedRef<TEntityArchetype<FragmentTypes...>> Archetype = MakeShared<
+        TEntityArchetype<FragmentTypes...>>(Name, Faction, Type);
+    Archetypes.Add(Name, Archetype);
+    return *Archetype;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Entities/EntityHotData.h"
+
+/**
+ * Immutable copy of the entity registry's hot data, published by the entity manager at most once
+ * per frame, when the first reader asks for it.
+ * Holds only plain values - no UObject references - so worker threads can read a snapshot without
+ * locks while the game thread keeps mutating the live registry. Handles taken from a snapshot must
+ * be resolved back through the entity manager on the game thread before touching the entity.
+ */
+struct DDKNOCKOFF_API FEntityRegistrySnapshot {
+    /** Count of snapshots published before and including this one */
+    uint64 FrameNumber = 0;
+
+    /** Hot fields for every registered entity at the time of publication */
+    FEntityHotData Data;
+
+    int32 Num() const { return Data.Num(); }
+
+    /**
+     * Visit every entity within a radius that passes a filter.
+     * @param Filter - Criteria evaluated against the snapshot data
+     * @param Center - Query center
+     * @param Radius - Query radius
+     * @param Visitor - Called as Visitor(Index) with the entity's index into Data
+     */
+    template <typename VisitorType>
+    void ForEachInRadius(const FEntityQueryFilter& Filter,
+                         const FVector& Center,
+                         const float Radius,
+                         VisitorType&& Visitor) const {
+        const float RadiusSquared = Radius * Radius;
+        for (int32 Index = 0; Index < Data.Num(); ++Index) {
+            if (FVector::DistSquared(Data.Positions[Index], Center) <= RadiusSquared
+                && Data.Matches(Index, Filter)) {
+                Visitor(Index);
+            }
+        }
+    }
+
+    /**
+     * Find the entity nearest to a point that passes a filter.
+     * @param Filter - Criteria evaluated against the snapshot data
+     * @param Center - Query center
+     * @param MaxRadius - Entities further than this are ignored
+     * @return Handle of the nearest matching entity, or a null handle if none match
+     */
+    FEntityHandle FindNearest(const FEntityQueryFilter& Filter,
+                              const FVector& Center,
+                              float MaxRadius = FLT_MAX) const;
+
+    /**
+     * Count the entities that pass a filter.
+     * @param Filter - Criteria evaluated against the snapshot data
+     * @return Number of matching entities
+     */
+    int32 Count(const FEntityQueryFilter& Filter) const;
+};
+
+using FEntityRegistrySnapshotPtr = TSharedPtr<const FEntityRegistrySnapshot, ESPMode::ThreadSafe>;
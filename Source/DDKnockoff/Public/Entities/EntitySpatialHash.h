@@ -0,0 +1,235 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
+
+/**
+ * Uniform 2D grid over the XY plane that buckets entity positions for radius and nearest queries.
+ * Entries are keyed by an integer ID (the entity manager's slot index) and can be inserted, moved
+ * and removed in O(1). Cells are dropped once empty, and queries never look past the bounds of the
+ * cells that are occupied, which ShrinkBounds tightens after removals. Distances are measured in
+ * 3D so results match actor-to-actor distance.
+ */
+class DDKNOCKOFF_API FEntitySpatialHash {
+public:
+    explicit FEntitySpatialHash(float InCellSize = 500.0f);
+
+    // Entry management
+
+    /**
+     * Add an entry at a position.
+     * @param Id - Non-negative ID of the entry, must not already be present
+     * @param Position - World position of the entry
+     */
+    void Insert(int32 Id, const FVector& Position);
+
+    /**
+     * Move an existing entry, re-bucketing it only if it changed cell.
+     * @param Id - ID of the entry
+     * @param Position - New world position
+     */
+    void Update(int32 Id, const FVector& Position);
+
+    /**
+     * Remove an entry if present.
+     * @param Id - ID of the entry
+     */
+    void Remove(int32 Id);
+
+    void Reset();
+
+    /**
+     * Shrink the bounds to the cells still occupied, if an edge cell emptied since the last call.
+     * Until then the bounds only over-cover, which costs queries some empty cells but never
+     * results, so callers run this once per frame instead of on every removal.
+     */
+    void ShrinkBounds();
+
+    bool Contains(int32 Id) const {
+        return Entries.IsValidIndex(Id) && Entries[Id].IndexInCell != INDEX_NONE;
+    }
+
+    const FVector& GetPosition(int32 Id) const { return Entries[Id].Position; }
+
+    float GetCellSize() const { return CellSize; }
+
+    SIZE_T GetAllocatedSize() const;
+
+    // Queries
+
+    /**
+     * Visit every entry within a radius of a point.
+     * @param Center - Query center
+     * @param Radius - Query radius
+     * @param Visitor - Called as Visitor(Id, DistanceSquared) for each entry in range
+     */
+    template <typename VisitorType>
+    void ForEachInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const;
+
+    /**
+     * Find the entries closest to a point, nearest first.
+     * Searches outwards ring by ring and stops once no unvisited cell can beat the current results.
+     * @param Center - Query center
+     * @param Count - Maximum number of entries to return
+     * @param MaxRadius - Entries further than this are ignored
+     * @param Predicate - Called as Predicate(Id) to accept or reject candidates
+     * @param OutIds - Receives the closest accepted entry IDs
+     */
+    template <typename PredicateType>
+    void FindNearest(const FVector& Center,
+                     int32 Count,
+                     float MaxRadius,
+                     PredicateType&& Predicate,
+                     TArray<int32>& OutIds) const;
+
+private:
+    struct FEntry {
+        FVector Position = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        int32 IndexInCell = INDEX_NONE;
+    };
+
+    FIntPoint GetCellFor(const FVector& Position) const;
+
+    /**
+     * Cells covered by a square around a point, clamped to the occupied bounds so that huge
+     * radii cannot overflow the cell coordinates.
+     * @param Center - Center of the square
+     * @param HalfExtent - Half the side of the square
+     * @param OutMinCell - Receives the lowest covered cell
+     * @param OutMaxCell - Receives the highest covered cell
+     */
+    void GetOccupiedCellRange(const FVector& Center,
+                              float HalfExtent,
+                              FIntPoint& OutMinCell,
+                              FIntPoint& OutMaxCell) const;
+
+    void AddToCell(int32 Id, const FIntPoint& Cell);
+    void RemoveFromCell(int32 Id);
+
+    /**
+     * Visit every entry in cells at exactly the given Chebyshev ring distance from a cell.
+     * @param CenterCell - Cell at the center of the ring
+     * @param Ring - Ring distance, zero visits only the center cell
+     * @param Visitor - Called as Visitor(Id) for each entry
+     */
+    template <typename VisitorType>
+    void ForEachInRing(const FIntPoint& CenterCell, int32 Ring, VisitorType&& Visitor) const;
+
+    float CellSize;
+    float InvCellSize;
+
+    TMap<FIntPoint, TArray<int32>> Cells;
+    TArray<FEntry> Entries;
+
+    // Bounds of the occupied cells, caps how far queries expand
+    FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+    FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+
+    /** An edge cell emptied, so the bounds may cover more than the occupied cells */
+    bool bBoundsDirty = false;
+};
+
+template <typename VisitorType>
+void FEntitySpatialHash::ForEachInRadius(const FVector& Center,
+                                         const float Radius,
+                                         VisitorType&& Visitor) const {
+    if (Cells.IsEmpty() || Radius < 0.0f) { return; }
+
+    const float RadiusSquared = Radius * Radius;
+    FIntPoint MinQueryCell;
+    FIntPoint MaxQueryCell;
+    GetOccupiedCellRange(Center, Radius, MinQueryCell, MaxQueryCell);
+
+    for (int32 X = MinQueryCell.X; X <= MaxQueryCell.X; ++X) {
+        for (int32 Y = MinQueryCell.Y; Y <= MaxQueryCell.Y; ++Y) {
+            const TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y));
+            if (!Cell) { continue; }
+
+            for (const int32 Id : *Cell) {
+                const float DistanceSquared = FVector::DistSquared(Entries[Id].Position, Center);
+                if (DistanceSquared <= RadiusSquared) { Visitor(Id, DistanceSquared); }
+            }
+        }
+    }
+}
+
+template <typename PredicateType>
+void FEntitySpatialHash::FindNearest(const FVector& Center,
+                                     const int32 Count,
+                                     const float MaxRadius,
+                                     PredicateType&& Predicate,
+                                     TArray<int32>& OutIds) const {
+    OutIds.Reset();
+    if (Cells.IsEmpty() || Count <= 0) { return; }
+
+    // Best candidates so far, kept sorted nearest first and capped at Count
+    TArray<TPair<float, int32>, TInlineAllocator<8>> Best;
+    const float MaxRadiusSquared = MaxRadius * MaxRadius;
+    const FIntPoint CenterCell = GetCellFor(Center);
+
+    // No occupied cell lies further out than this ring, and the radius is clamped to it before
+    // converting so that huge radii cannot overflow
+    const int32 BoundsRing = FMath::Max(
+        FMath::Max(FMath::Abs(CenterCell.X - MinCell.X), FMath::Abs(MaxCell.X - CenterCell.X)),
+        FMath::Max(FMath::Abs(CenterCell.Y - MinCell.Y), FMath::Abs(MaxCell.Y - CenterCell.Y)));
+    const float RadiusRings = FMath::Clamp(MaxRadius * InvCellSize,
+                                           0.0f,
+                                           static_cast<float>(BoundsRing));
+    const int32 LastRing = FMath::Min(BoundsRing, FMath::CeilToInt(RadiusRings) + 1);
+
+    for (int32 Ring = 0; Ring <= LastRing; ++Ring) {
+        ForEachInRing(CenterCell,
+                      Ring,
+                      [&](const int32 Id) {
+                          const float DistanceSquared = FVector::DistSquared(
+                              Entries[Id].Position,
+                              Center);
+                          if (DistanceSquared > MaxRadiusSquared) { return; }
+                          if (Best.Num() == Count && DistanceSquared >= Best.Last().Key) { return; }
+                          if (!Predicate(Id)) { return; }
+
+                          const int32 InsertIndex = Algo::UpperBoundBy(
+                              Best,
+                              DistanceSquared,
+                              [](const TPair<float, int32>& Pair) { return Pair.Key; });
+                          Best.Insert(TPair<float, int32>(DistanceSquared, Id), InsertIndex);
+                          if (Best.Num() > Count) { Best.Pop(EAllowShrinking::No); }
+                      });
+
+        // Every cell beyond this ring is at least Ring cells away in XY, so nothing there can win
+        if (Best.Num() == Count) {
+            const float RingDistance = Ring * CellSize;
+            if (Best.Last().Key <= RingDistance * RingDistance) { break; }
+        }
+    }
+
+    OutIds.Reserve(Best.Num());
+    for (const TPair<float, int32>& Pair : Best) { OutIds.Add(Pair.Value); }
+}
+
+template <typename VisitorType>
+void FEntitySpatialHash::ForEachInRing(const FIntPoint& CenterCell,
+                                       const int32 Ring,
+                                       VisitorType&& Visitor) const {
+    auto VisitCell = [this, &Visitor](const int32 X, const int32 Y) {
+        if (const TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y))) {
+            for (const int32 Id : *Cell) { Visitor(Id); }
+        }
+    };
+
+    if (Ring == 0) {
+        VisitCell(CenterCell.X, CenterCell.Y);
+        return;
+    }
+
+    // Top and bottom rows, then the left and right columns without their corners
+    for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; ++X) {
+        VisitCell(X, CenterCell.Y - Ring);
+        VisitCell(X, CenterCell.Y + Ring);
+    }
+    for (int32 Y = CenterCell.Y - Ring + 1; Y <= CenterCell.Y + Ring - 1; ++Y) {
+        VisitCell(CenterCell.X - Ring, Y);
+        VisitCell(CenterCell.X + Ring, Y);
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IEntity;
+
+/**
+ * Non-owning, read-only view over one of the entity manager's query buckets.
+ * Avoids the allocation and copy of returning the bucket by value. A view is only valid until the
+ * next registration or unregistration - in builds with checks enabled, accessing a view after the
+ * registry has been mutated asserts.
+ */
+class FEntityView {
+public:
+    using FElement = TScriptInterface<IEntity>;
+    using FConstIterator = const FElement*;
+
+    FEntityView() = default;
+
+#if DO_CHECK
+    FEntityView(const TArray<FElement>& InEntities, const uint32& InMutationSerial)
+        : Entities(&InEntities), MutationSerial(&InMutationSerial),
+          SerialAtCreation(InMutationSerial) {}
+#else
+    FEntityView(const TArray<FElement>& InEntities, const uint32& InMutationSerial)
+        : Entities(&InEntities) {}
+#endif
+
+    int32 Num() const {
+        CheckNotStale();
+        return Entities ? Entities->Num() : 0;
+    }
+
+    bool IsEmpty() const { return Num() == 0; }
+
+    const FElement& operator[](const int32 Index) const {
+        CheckNotStale();
+        return (*Entities)[Index];
+    }
+
+    FConstIterator begin() const {
+        CheckNotStale();
+        return Entities ? Entities->GetData() : nullptr;
+    }
+
+    FConstIterator end() const {
+        CheckNotStale();
+        return Entities ? Entities->GetData() + Entities->Num() : nullptr;
+    }
+
+private:
+    void CheckNotStale() const {
+#if DO_CHECK
+        checkf(!MutationSerial || *MutationSerial == SerialAtCreation,
+               TEXT("FEntityView used after the entity registry was modified"));
+#endif
+    }
+
+    const TArray<FElement>* Entities = nullptr;
+
+#if DO_CHECK
+    const uint32* MutationSerial = nullptr;
+    uint32 SerialAtCreation = 0;
+#endif
+};
@@ -35,6 +35,12 @@ public:
     UFUNCTION(BlueprintCallable, Category="Health")
     bool IsDead() const;
 
+    /**
+     * Restore full health and hide the health bar, as at the start of play.
+     */
+    UFUNCTION(BlueprintCallable, Category="Health")
+    void ResetHealth();
+
     /**
      * Get the current health value.
      * @return Current health amount
@@ -54,9 +60,7 @@ public:
      * Set current health directly - FOR TESTING ONLY.
      * @param NewHealth - New health value to set
      */
-    void SetCurrentHealthForTesting(float NewHealth) {
-        CurrentHealth = FMath::Clamp(NewHealth, 0.0f, MaxHealth);
-    }
+    void SetCurrentHealthForTesting(float NewHealth);
 #endif
 
     // UI management
@@ -112,4 +116,9 @@ private:
      * Update health bar visibility based on current health and configuration.
      */
     void UpdateHealthBarVisibility();
+
+    /**
+     * Push the current health into the entity manager's hot data if the owner is an entity.
+     */
+    void PublishHealthToEntityManager() const;
 };
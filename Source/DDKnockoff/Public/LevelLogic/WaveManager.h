@@ -5,6 +5,7 @@
 #include "UObject/Object.h"
 #include "Containers/Queue.h"
 #include "Core/ManagerBase.h"
+#include "Core/ManagerJob.h"
 #include "WaveManager.generated.h"
 
 class UWaveManagerSettings;
@@ -58,6 +59,14 @@ public:
     virtual void Initialize() override;
     virtual void Deinitialize() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+    virtual SIZE_T GetAllocatedSize() const override;
+
+    /** Spawns before actors tick so new enemies start moving the frame they appear */
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
 
     // Wave control
 
@@ -67,10 +76,17 @@ public:
     void StartNextWave();
 
     /**
-     * Discover and register all spawners in the level.
+     * Discover and register all spawners in the level. The actor scan is time-sliced over
+     * several frames; the manager moves to WaitingToStart once it finishes.
      */
     void CollectSpawners();
 
+    /**
+     * Check whether spawner collection is still scanning the level.
+     * @return true if collection has not finished yet
+     */
+    bool IsCollectingSpawners() const;
+
     /**
      * Close all doors.
      */
@@ -124,6 +140,13 @@ private:
 
     // Spawning system
 
+    /**
+     * Get the time countdowns and spawn pacing are measured in. World time, so waves pause with
+     * the game and follow fixed-step simulation instead of the wall clock.
+     * @return Current world time in seconds
+     */
+    double GetWaveTime() const;
+
     /**
      * Process ongoing wave spawning based on timing and spawner availability.
      */
@@ -142,6 +165,17 @@ private:
 
     // Spawner management
 
+    /**
+     * Scan the next batch of actors for spawners.
+     * @return Complete once every level has been scanned
+     */
+    EManagerJobStatus CollectSpawnersStep();
+
+    /**
+     * Run any remaining spawner collection immediately.
+     */
+    void FinishCollectingSpawners();
+
     /**
      * Find spawner instance by ID for efficient lookup.
      * @param SpawnerId - ID of spawner to find
@@ -189,6 +223,11 @@ private:
     // Cached data
 
     TMap<int32, TWeakObjectPtr<ASpawner>> SpawnerMap;
+
+    // Spawner collection progress, resumes from this level and actor index each step
+    FManagerJobHandle SpawnerCollectionJob;
+    int32 SpawnerCollectionLevelIndex;
+    int32 SpawnerCollectionActorIndex;
     TArray<FWaveSpawnCache> WaveCache;
 
     // Timing
@@ -126,6 +126,7 @@ public:
     virtual AActor* GetActor() override;
     virtual EEntityType GetEntityType() const override;
     virtual UEntityData* GetEntityData() const override;
+    virtual void ResetEntity() override;
 
 protected:
     virtual void NotifyControllerChanged() override;
@@ -383,6 +384,9 @@ protected:
     UPROPERTY(Transient)
     TObjectPtr<APlayerController> CachedPlayerController;
 
+    /** Where the character began play, returned to on a level reset */
+    FTransform StartTransform;
+
     // Combo system state
     bool bComboInputBuffered = false;
     FTimerHandle ComboWindowTimerHandle;
@@ -86,6 +86,7 @@ public:
     virtual EEntityType GetEntityType() const override;
     virtual EFaction GetFaction() const override;
     virtual void Interact() override;
+    virtual void ResetEntity() override;
 
     // IDependencyInjectable Interface
     virtual bool HasRequiredDependencies() const override;
@@ -128,6 +129,7 @@ protected:
     void UpdateScale(float DeltaTime);
     void DisableChest() const;
     void EnableChest() const;
+    void NotifyNavAreaChanged() const;
 
     // Chest configuration
 
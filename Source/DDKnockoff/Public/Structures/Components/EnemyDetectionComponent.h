@@ -4,8 +4,11 @@
 #include "Components/SphereComponent.h"
 #include "Entities/FactionEnums.h"
 #include "Core/ConfigurationValidatable.h"
+#include "Entities/EntityHandle.h"
 #include "EnemyDetectionComponent.generated.h"
 
+class UEntityManager;
+
 /**
  * Result structure for enemy detection operations.
  */
@@ -23,6 +26,7 @@ struct FEnemyDetectionResult {
 /**
  * Component that detects enemy entities within a configurable radius and optional vision cone.
  * Used by defensive structures and AI characters for target acquisition.
+ * Queries the entity manager's spatial hash rather than the physics scene.
  * Supports both omnidirectional and directional detection modes.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -80,21 +84,23 @@ protected:
 
     // Components
 
+    /** Visualizes the detection radius, it has no collision */
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Detection")
     TObjectPtr<USphereComponent> DetectionSphere;
 
-    // Runtime state
-
-    UPROPERTY(Transient)
-    TArray<AActor*> ActorsInRange;
-
 private:
     /**
      * Check for enemies within detection range and find the closest one.
      * @param OutClosestEnemy - Reference to store the closest enemy found
      * @return true if enemies were found
      */
-    bool CheckForEnemiesInRange(TObjectPtr<AActor>& OutClosestEnemy) const;
+    bool CheckForEnemiesInRange(TObjectPtr<AActor>& OutClosestEnemy);
+
+    /**
+     * Get the entity manager, fetching it from the world on first use.
+     * @return Entity manager or null if unavailable
+     */
+    UEntityManager* GetEntityManager();
 
     /**
      * Get the faction of the component's owner for enemy identification.
@@ -108,4 +114,12 @@ private:
      * @return true if actor is within vision cone
      */
     bool IsActorInVisionCone(AActor* Actor) const;
+
+    // Dependencies
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEntityManager> EntityManager;
+
+    // Scratch buffer reused between queries to avoid per-frame allocations
+    TArray<FEntityHandle> NearestHandles;
 };
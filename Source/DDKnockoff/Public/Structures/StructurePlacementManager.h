@@ -19,6 +19,7 @@ public:
     // ManagerBase Interface
     virtual void Initialize() override;
     virtual void Deinitialize() override;
+    virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
 
     // Settings access
 
@@ -54,7 +55,8 @@ protected:
 
 private:
     /**
-     * Load the placement settings data asset synchronously during initialization.
+     * Resolve the placement settings and preview material during initialization, loading them
+     * synchronously if they were not preloaded.
      */
     void LoadPlacementSettings();
 
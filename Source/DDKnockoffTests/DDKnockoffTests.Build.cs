@@ -25,6 +25,7 @@ public class DDKnockoffTests : ModuleRules
 		        "AutomationController",
 		        "AutomationUtils",
 		        "NavigationSystem",
+		        "AIModule",
 		        "UnrealEd",
 		        "FunctionalTesting",
 	        }
@@ -0,0 +1,8 @@
+#include "Mocks/MockEntity.h"
+
+#include "Entities/EntityData.h"
+
+UMockEntity::UMockEntity() {
+    // Create entity data
+    EntityData = CreateDefaultSubobject<UEntityData>(TEXT("EntityData"));
+}
@@ -0,0 +1,67 @@
+#include "Mocks/MockManagers.h"
+
+FCriticalSection UMockOrderedManager::LogLock;
+TArray<FName> UMockOrderedManager::InitializationLog;
+TArray<FName> UMockOrderedManager::TickLog;
+
+const TCHAR* UMockPreloadManager::FirstAssetPath =
+    TEXT("/Engine/EngineMaterials/DefaultMaterial.DefaultMaterial");
+const TCHAR* UMockPreloadManager::SecondAssetPath =
+    TEXT("/Engine/EngineMaterials/WorldGridMaterial.WorldGridMaterial");
+
+void UMockOrderedManager::Initialize() {
+    FScopeLock Lock(&LogLock);
+    InitializationLog.Add(GetClass()->GetFName());
+}
+
+void UMockOrderedManager::Tick(float DeltaTime) {
+    FScopeLock Lock(&LogLock);
+    TickLog.Add(GetClass()->GetFName());
+}
+
+TArray<FName> UMockOrderedManager::GetInitializationLog() {
+    FScopeLock Lock(&LogLock);
+    return InitializationLog;
+}
+
+void UMockOrderedManager::ResetInitializationLog() {
+    FScopeLock Lock(&LogLock);
+    InitializationLog.Reset();
+}
+
+TArray<FName> UMockOrderedManager::GetTickLog() {
+    FScopeLock Lock(&LogLock);
+    return TickLog;
+}
+
+void UMockOrderedManager::ResetTickLog() {
+    FScopeLock Lock(&LogLock);
+    TickLog.Reset();
+}
+
+void UMockMiddleManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UMockRootManager::StaticClass());
+}
+
+void UMockLeafManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UMockMiddleManager::StaticClass());
+    OutDependencies.Add(UMockRootManager::StaticClass());
+}
+
+void UMockConcurrentManager::GetDependencies(
+    TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UMockRootManager::StaticClass());
+}
+
+void UMockCycleAManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UMockCycleBManager::StaticClass());
+}
+
+void UMockCycleBManager::GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const {
+    OutDependencies.Add(UMockCycleAManager::StaticClass());
+}
+
+void UMockPreloadManager::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const {
+    OutAssets.Add(FSoftObjectPath(FirstAssetPath));
+    if (PreloadRequests++ > 0) { OutAssets.Add(FSoftObjectPath(SecondAssetPath)); }
+}
@@ -1,5 +1,12 @@
 #include "Tests/Common/TestUtils.h"
 
+#include "Components/BoxComponent.h"
+#include "Core/DDKnockoffGameSettings.h"
+#include "Enemies/DDAICharacter.h"
+#include "LevelLogic/LevelData.h"
+#include "LevelLogic/WaveManagerSettings.h"
+#include "Utils/CollisionUtils.h"
+
 void FTestUtils::TickMultipleFrames(const FTestWorldHelper* WorldHelper,
                                     int32 FrameCount,
                                     float DeltaTime) {
@@ -58,3 +65,43 @@ bool FTestUtils::WaitForCondition(const FTestWorldHelper* WorldHelper,
            TimeoutSeconds);
     return false;
 }
+
+UClass* FTestUtils::LoadEnemyCharacterClass() {
+    // Enemy blueprints carry the mesh and anim class the C++ character needs to run
+    const UDDKnockoffGameSettings* GameSettings = UDDKnockoffGameSettings::Get();
+    if (!GameSettings || GameSettings->WaveManagerSettingsAsset.IsNull()) { return nullptr; }
+
+    const UWaveManagerSettings* WaveSettings = Cast<UWaveManagerSettings>(
+        GameSettings->WaveManagerSettingsAsset.TryLoad());
+    if (!WaveSettings || !WaveSettings->LevelData) { return nullptr; }
+
+    for (const FWaveData& Wave : WaveSettings->LevelData->Waves) {
+        for (const FSpawnerWaveData& SpawnerEntry : Wave.SpawnerEntries) {
+            for (const FEnemySpawnData& Enemy : SpawnerEntry.Enemies) {
+                if (Enemy.EnemyClass && Enemy.EnemyClass->IsChildOf<ADDAICharacter>()) {
+                    return Enemy.EnemyClass;
+                }
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+UBoxComponent* FTestUtils::AddHurtbox(AActor* Actor,
+                                      const FVector& RelativeLocation,
+                                      const FVector& BoxExtent) {
+    if (!Actor) { return nullptr; }
+
+    UBoxComponent* Hurtbox = NewObject<UBoxComponent>(Actor);
+    Hurtbox->SetBoxExtent(BoxExtent);
+    UCollisionUtils::SetupHurtbox(Hurtbox);
+    Hurtbox->SetupAttachment(Actor->GetRootComponent());
+    Hurtbox->SetRelativeLocation(RelativeLocation);
+    Actor->AddInstanceComponent(Hurtbox);
+    Hurtbox->RegisterComponent();
+
+    // Registering a component doesn't look for overlaps, moving or spawning does
+    Actor->UpdateOverlaps();
+    return Hurtbox;
+}
@@ -118,4 +118,29 @@ void FHealthComponentSpec::Define() {
                      HealthComponent->GetCurrentHealth(), HealthComponent->GetMaxHealth());
         });
     });
-}
\ No newline at end of file
+
+    Describe("Reset", [this] {
+        It("should restore full health after damage", [this] {
+            // Arrange
+            HealthComponent->TakeDamage(HealthComponent->GetMaxHealth() * 0.5f);
+
+            // Act
+            HealthComponent->ResetHealth();
+
+            // Assert
+            TestEqual("CurrentHealth should equal MaxHealth after reset",
+                     HealthComponent->GetCurrentHealth(), HealthComponent->GetMaxHealth());
+        });
+
+        It("should revive a dead component", [this] {
+            // Arrange
+            HealthComponent->TakeDamage(HealthComponent->GetMaxHealth());
+
+            // Act
+            HealthComponent->ResetHealth();
+
+            // Assert
+            TestFalse("Should no longer report dead", HealthComponent->IsDead());
+        });
+    });
+}
@@ -0,0 +1,387 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Core/ManagerHandlerSubsystem.h"
+#include "Mocks/MockManagers.h"
+#include "Tests/Common/TestUtils.h"
+
+BEGIN_DEFINE_SPEC(FManagerHandlerSubsystemSpec,
+                  "DDKnockoff.Core.ManagerHandlerSubsystem",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UManagerHandlerSubsystem> ManagerHandler;
+
+END_DEFINE_SPEC(FManagerHandlerSubsystemSpec)
+
+void FManagerHandlerSubsystemSpec::Define() {
+    BeforeEach([this] {
+        UMockOrderedManager::ResetInitializationLog();
+
+        // SPEC_BOILERPLATE_BEGIN
+        // Listed dependents-first so list order alone would initialize them wrongly
+        BaseSpec.SetupBaseSpecEnvironment({
+            UMockLeafManager::StaticClass(),
+            UMockMiddleManager::StaticClass(),
+            UMockRootManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        ManagerHandler = BaseSpec.WorldHelper->GetWorld()->GetSubsystem<UManagerHandlerSubsystem>();
+        TestTrue("ManagerHandler should be available", ManagerHandler != nullptr);
+    });
+
+    AfterEach([this] {
+        ManagerHandler = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Dependency Ordering", [this] {
+        It("should initialize dependencies before dependents", [this] {
+            // Act
+            const TArray<FName> Log = UMockOrderedManager::GetInitializationLog();
+
+            // Assert
+            TestEqual("Should initialize every manager", Log.Num(), 3);
+            TestEqual("Root should be first", Log[0], UMockRootManager::StaticClass()->GetFName());
+            TestEqual("Middle should be second", Log[1], UMockMiddleManager::StaticClass()->GetFName());
+            TestEqual("Leaf should be last", Log[2], UMockLeafManager::StaticClass()->GetFName());
+        });
+
+        It("should expose managers in initialization order", [this] {
+            // Act
+            const TArray<UManagerBase*>& OrderedManagers = ManagerHandler->GetOrderedManagers();
+
+            // Assert
+            TestEqual("Should order every manager", OrderedManagers.Num(), 3);
+            TestTrue("Root should be first", OrderedManagers[0]->IsA<UMockRootManager>());
+            TestTrue("Leaf should be last", OrderedManagers[2]->IsA<UMockLeafManager>());
+        });
+
+        It("should ignore dependencies outside the manager set", [this] {
+            // Arrange
+            UMockOrderedManager::ResetInitializationLog();
+
+            // Act
+            ManagerHandler->SetManagers({UMockLeafManager::StaticClass()});
+
+            // Assert
+            TestEqual("Should still initialize the manager", UMockOrderedManager::GetInitializationLog().Num(), 1);
+            TestNotNull("Should register the manager", ManagerHandler->GetManager<UMockLeafManager>());
+        });
+
+        It("should initialize concurrent managers after their dependencies", [this] {
+            // Arrange
+            UMockOrderedManager::ResetInitializationLog();
+
+            // Act
+            ManagerHandler->SetManagers({UMockConcurrentManager::StaticClass(), UMockRootManager::StaticClass()});
+            const TArray<FName> Log = UMockOrderedManager::GetInitializationLog();
+
+            // Assert
+            TestEqual("Should initialize both managers", Log.Num(), 2);
+            TestEqual("Root should be first", Log[0], UMockRootManager::StaticClass()->GetFName());
+            TestEqual("Concurrent manager should follow", Log[1], UMockConcurrentManager::StaticClass()->GetFName());
+        });
+    });
+
+    Describe("Manager Lookup", [this] {
+        It("should assign each manager class its own stable slot", [this] {
+            // Act
+            const int32 RootSlot = TManagerSlot<UMockRootManager>::Get();
+            const int32 LeafSlot = TManagerSlot<UMockLeafManager>::Get();
+
+            // Assert
+            TestNotEqual("Different classes should get different slots", RootSlot, LeafSlot);
+            TestEqual("Slot should match the registry",
+                      FManagerSlotRegistry::GetSlot(UMockRootManager::StaticClass()), RootSlot);
+        });
+
+        It("should resolve managers through the world accessor", [this] {
+            // Act
+            UWorld* World = BaseSpec.WorldHelper->GetWorld();
+            UMockRootManager* FromWorld = UManagerHandlerSubsystem::GetManager<UMockRootManager>(World);
+
+            // Assert
+            TestTrue("Should return the registered instance", FromWorld == ManagerHandler->GetManager<UMockRootManager>());
+            TestTrue("Should cache the world's subsystem", UManagerHandlerSubsystem::Get(World) == ManagerHandler);
+            TestNull("Should return null for a null world", UManagerHandlerSubsystem::GetManager<UMockRootManager>(nullptr));
+        });
+
+        It("should return null for managers outside the current set", [this] {
+            // Act
+            ManagerHandler->SetManagers({UMockRootManager::StaticClass()});
+
+            // Assert
+            TestNotNull("Should find the registered manager", ManagerHandler->GetManager<UMockRootManager>());
+            TestNull("Should not find a cleared manager", ManagerHandler->GetManager<UMockLeafManager>());
+        });
+    });
+
+    Describe("Cycle Detection", [this] {
+        It("should report a dependency cycle", [this] {
+            // Arrange
+            AddExpectedError(TEXT("dependency cycle"), EAutomationExpectedErrorFlags::Contains, 2);
+            const TArray<UManagerBase*> Managers = {
+                NewObject<UMockCycleAManager>(ManagerHandler),
+                NewObject<UMockCycleBManager>(ManagerHandler),
+                NewObject<UMockRootManager>(ManagerHandler)
+            };
+            TArray<TArray<UManagerBase*>> Levels;
+
+            // Act
+            const bool bSorted = UManagerHandlerSubsystem::SortByDependencies(Managers, Levels);
+
+            // Assert
+            TestFalse("Should fail to sort", bSorted);
+            TestEqual("Should still level the managers outside the cycle", Levels.Num(), 1);
+        });
+    });
+
+    Describe("Tick Phases", [this] {
+        It("should tick earlier phases before late managers", [this] {
+            // Arrange
+            ManagerHandler->SetManagers({UMockRootManager::StaticClass(), UMockPrePhysicsManager::StaticClass()});
+            UMockOrderedManager::ResetTickLog();
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+            const TArray<FName> Log = UMockOrderedManager::GetTickLog();
+
+            // Assert
+            TestEqual("Should tick both managers once", Log.Num(), 2);
+            TestEqual("PrePhysics manager should tick first", Log[0], UMockPrePhysicsManager::StaticClass()->GetFName());
+            TestEqual("Late manager should tick last", Log[1], UMockRootManager::StaticClass()->GetFName());
+        });
+
+        It("should finish worker ticks within the frame", [this] {
+            // Arrange
+            ManagerHandler->SetManagers({UMockWorkerTickManager::StaticClass()});
+            UMockOrderedManager::ResetTickLog();
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 3);
+
+            // Assert
+            TestEqual("Should tick the worker manager every frame", UMockOrderedManager::GetTickLog().Num(), 3);
+        });
+    });
+
+    Describe("Time-Sliced Jobs", [this] {
+        It("should carry remaining work over to later frames", [this] {
+            // Arrange - a zero budget allows one step per frame
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            const FManagerJobHandle Job = ManagerHandler->SubmitJob(TEXT("ThreeSteps"), 0.0f, [StepsRun] {
+                return ++*StepsRun == 3 ? EManagerJobStatus::Complete : EManagerJobStatus::Continue;
+            });
+
+            // Act
+            ManagerHandler->RunJobs();
+
+            // Assert
+            TestEqual("Should run one step in the first frame", *StepsRun, 1);
+            TestTrue("Job should still be pending", ManagerHandler->IsJobPending(Job));
+
+            // Act
+            ManagerHandler->RunJobs();
+            ManagerHandler->RunJobs();
+
+            // Assert
+            TestEqual("Should run every step", *StepsRun, 3);
+            TestFalse("Job should be complete", ManagerHandler->IsJobPending(Job));
+            TestEqual("Should count the completion", ManagerHandler->GetJobStats().CompletedJobs, 1);
+            TestEqual("Should have nothing pending", ManagerHandler->GetJobStats().PendingJobs, 0);
+        });
+
+        It("should run several steps in one frame when the budget allows", [this] {
+            // Arrange
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            const FManagerJobHandle Job = ManagerHandler->SubmitJob(TEXT("FiveSteps"), 1000.0f, [StepsRun] {
+                return ++*StepsRun == 5 ? EManagerJobStatus::Complete : EManagerJobStatus::Continue;
+            });
+
+            // Act
+            ManagerHandler->RunJobs();
+
+            // Assert
+            TestEqual("Should run every step", *StepsRun, 5);
+            TestFalse("Job should be complete", ManagerHandler->IsJobPending(Job));
+        });
+
+        It("should run jobs from the subsystem tick", [this] {
+            // Arrange
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            ManagerHandler->SubmitJob(TEXT("Ticked"), 0.0f, [StepsRun] {
+                ++*StepsRun;
+                return EManagerJobStatus::Continue;
+            });
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 2);
+
+            // Assert
+            TestEqual("Should run one step per frame", *StepsRun, 2);
+        });
+
+        It("should record budget overruns", [this] {
+            // Arrange
+            ManagerHandler->SubmitJob(TEXT("Slow"), 0.0f, [] {
+                FPlatformProcess::Sleep(0.002f);
+                return EManagerJobStatus::Continue;
+            });
+
+            // Act
+            ManagerHandler->RunJobs();
+
+            // Assert
+            const FManagerJobStats& Stats = ManagerHandler->GetJobStats();
+            TestEqual("Should record the overrun", Stats.BudgetOverruns, 1);
+            TestTrue("Should record how far over budget it went", Stats.WorstOverrunMs > 0.0f);
+            TestTrue("Should record the frame's job time", Stats.LastFrameMs >= Stats.WorstOverrunMs);
+        });
+
+        It("should not run cancelled jobs", [this] {
+            // Arrange
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            const FManagerJobHandle Job = ManagerHandler->SubmitJob(TEXT("Cancelled"), 0.0f, [StepsRun] {
+                ++*StepsRun;
+                return EManagerJobStatus::Continue;
+            });
+
+            // Act
+            const bool bCancelled = ManagerHandler->CancelJob(Job);
+            ManagerHandler->RunJobs();
+
+            // Assert
+            TestTrue("Should cancel the pending job", bCancelled);
+            TestEqual("Should not run the cancelled job", *StepsRun, 0);
+            TestFalse("Should not cancel twice", ManagerHandler->CancelJob(Job));
+        });
+
+        It("should complete a job immediately on request", [this] {
+            // Arrange
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            const FManagerJobHandle Job = ManagerHandler->SubmitJob(TEXT("Completed"), 0.0f, [StepsRun] {
+                return ++*StepsRun == 10 ? EManagerJobStatus::Complete : EManagerJobStatus::Continue;
+            });
+
+            // Act
+            const bool bCompleted = ManagerHandler->CompleteJob(Job);
+
+            // Assert
+            TestTrue("Should complete the pending job", bCompleted);
+            TestEqual("Should run every step", *StepsRun, 10);
+            TestFalse("Job should no longer be pending", ManagerHandler->IsJobPending(Job));
+        });
+
+        It("should drop jobs whose owner has been destroyed", [this] {
+            // Arrange
+            UObject* Owner = NewObject<UMockRootManager>(ManagerHandler);
+            TSharedRef<int32> StepsRun = MakeShared<int32>(0);
+            const FManagerJobHandle Job = ManagerHandler->SubmitJob(TEXT("Owned"), 0.0f, [StepsRun] {
+                ++*StepsRun;
+                return EManagerJobStatus::Continue;
+            }, Owner);
+
+            // Act
+            Owner->MarkAsGarbage();
+            ManagerHandler->RunJobs();
+
+            // Assert
+            TestEqual("Should not run the orphaned job", *StepsRun, 0);
+            TestFalse("Should drop the orphaned job", ManagerHandler->IsJobPending(Job));
+        });
+    });
+
+    Describe("Asset Preloading", [this] {
+        It("should initialize managers before returning when blocking", [this] {
+            // Arrange
+            UMockOrderedManager::ResetInitializationLog();
+
+            // Act
+            ManagerHandler->SetManagers({UMockPreloadManager::StaticClass()});
+
+            // Assert
+            const FManagerAssetLoadStats& Stats = ManagerHandler->GetAssetLoadStats();
+            TestTrue("Managers should be ready", ManagerHandler->AreManagersReady());
+            TestEqual("Should initialize the manager", UMockOrderedManager::GetInitializationLog().Num(), 1);
+            TestFalse("Should record a blocking load", Stats.bStreamed);
+            TestTrue("First asset should be resident",
+                     FSoftObjectPath(UMockPreloadManager::FirstAssetPath).ResolveObject() != nullptr);
+        });
+
+        It("should keep requesting assets revealed by earlier rounds", [this] {
+            // Act
+            ManagerHandler->SetManagers({UMockPreloadManager::StaticClass()});
+
+            // Assert
+            const FManagerAssetLoadStats& Stats = ManagerHandler->GetAssetLoadStats();
+            TestEqual("Should request both assets", Stats.NumAssets, 2);
+            TestEqual("Should request the second asset in a later round", Stats.NumRounds, 2);
+            TestTrue("Second asset should be resident",
+                     FSoftObjectPath(UMockPreloadManager::SecondAssetPath).ResolveObject() != nullptr);
+        });
+
+        It("should initialize managers once streamed assets resolve", [this] {
+            // Arrange
+            TSharedRef<int32> ReadyCalls = MakeShared<int32>(0);
+
+            // Act
+            ManagerHandler->SetManagers({UMockPreloadManager::StaticClass()}, EManagerAssetLoading::Streamed);
+            ManagerHandler->CallWhenManagersReady(FSimpleDelegate::CreateLambda([ReadyCalls] { ++*ReadyCalls; }));
+            FlushAsyncLoading();
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestTrue("Managers should be ready", ManagerHandler->AreManagersReady());
+            TestEqual("Should run the ready callback once", *ReadyCalls, 1);
+            TestTrue("Should record a streamed load", ManagerHandler->GetAssetLoadStats().bStreamed);
+            TestEqual("Should request both assets", ManagerHandler->GetAssetLoadStats().NumAssets, 2);
+        });
+
+        It("should run ready callbacks immediately once managers are ready", [this] {
+            // Arrange
+            TSharedRef<int32> ReadyCalls = MakeShared<int32>(0);
+
+            // Act
+            ManagerHandler->CallWhenManagersReady(FSimpleDelegate::CreateLambda([ReadyCalls] { ++*ReadyCalls; }));
+
+            // Assert
+            TestEqual("Should run the callback right away", *ReadyCalls, 1);
+        });
+    });
+
+    Describe("Fixed-Step Simulation", [this] {
+        It("should advance world time by whole fixed steps", [this] {
+            // Arrange
+            ManagerHandler->SetManagers({UMockRootManager::StaticClass()});
+            UMockOrderedManager::ResetTickLog();
+            const double StartTime = BaseSpec.WorldHelper->GetWorld()->GetTimeSeconds();
+
+            // Act
+            const int32 Steps = ManagerHandler->Simulate(1.0f, 0.1f);
+
+            // Assert
+            TestEqual("Should run ten steps", Steps, 10);
+            TestEqual("Should tick the manager every step", UMockOrderedManager::GetTickLog().Num(), 10);
+            TestEqual("Should advance world time by the simulated seconds",
+                      BaseSpec.WorldHelper->GetWorld()->GetTimeSeconds() - StartTime,
+                      1.0,
+                      0.001);
+        });
+
+        It("should ignore non-positive durations", [this] {
+            // Act
+            const int32 Steps = ManagerHandler->Simulate(0.0f);
+
+            // Assert
+            TestEqual("Should run no steps", Steps, 0);
+        });
+    });
+}
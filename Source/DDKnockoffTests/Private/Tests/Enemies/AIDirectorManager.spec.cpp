@@ -0,0 +1,282 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Tests/Common/TestUtils.h"
+#include "Enemies/AIDirectorManager.h"
+#include "Enemies/AISignificanceManager.h"
+#include "Enemies/CrystalPathFieldManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/PathRequestManager.h"
+#include "Entities/EntityManager.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Mocks/MockEnemy.h"
+
+BEGIN_DEFINE_SPEC(FAIDirectorManagerSpec,
+                  "DDKnockoff.Enemies.AIDirectorManager",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UAIDirectorManager> AIDirector;
+    TObjectPtr<UCrystalPathFieldManager> CrystalPathField;
+    TObjectPtr<UPathRequestManager> PathRequests;
+    TObjectPtr<AMockEnemy> Crystal;
+
+    ADDAIController* SpawnController() const;
+    ADDAIController* SpawnPossessedEnemy(const FVector& Location) const;
+
+END_DEFINE_SPEC(FAIDirectorManagerSpec)
+
+void FAIDirectorManagerSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({
+            UEntityManager::StaticClass(),
+            UCrystalPathFieldManager::StaticClass(),
+            UAIDirectorManager::StaticClass(),
+            UPathRequestManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        UWorld* World = BaseSpec.WorldHelper->GetWorld();
+        AIDirector = UManagerHandlerSubsystem::GetManager<UAIDirectorManager>(World);
+        CrystalPathField = UManagerHandlerSubsystem::GetManager<UCrystalPathFieldManager>(World);
+        PathRequests = UManagerHandlerSubsystem::GetManager<UPathRequestManager>(World);
+        TestTrue("AIDirector should be available", AIDirector != nullptr);
+        TestTrue("Crystal path field should be available", CrystalPathField != nullptr);
+        TestTrue("PathRequests should be available", PathRequests != nullptr);
+
+        // The test world has no navmesh, so lay an open grid for the crystal search to read
+        Crystal = World->SpawnActorDeferred<AMockEnemy>(AMockEnemy::StaticClass(),
+                                                        FTransform(FVector(1000.0, 0.0, 0.0)));
+        Crystal->SetFaction(EFaction::Player);
+        Crystal->SetEntityType(EEntityType::Structure_Crystal);
+        Crystal->FinishSpawning(FTransform(FVector(1000.0, 0.0, 0.0)));
+        CrystalPathField->ResetGridForTesting(
+            FBox(FVector(-2000.0, -2000.0, -100.0), FVector(2000.0, 2000.0, 100.0)));
+        TestTrue("Field should be solved",
+                 FTestUtils::WaitForCondition(BaseSpec.WorldHelper.Get(),
+                                              [this] { return CrystalPathField->IsFieldReady(); },
+                                              1.0f,
+                                              TEXT("crystal path field")));
+    });
+
+    AfterEach([this] {
+        AIDirector = nullptr;
+        CrystalPathField = nullptr;
+        PathRequests = nullptr;
+        Crystal = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Agent Registration", [this] {
+        It("should keep other agents registered after a swap-removal", [this] {
+            // Arrange
+            ADDAIController* First = SpawnController();
+            ADDAIController* Second = SpawnController();
+            ADDAIController* Third = SpawnController();
+            AIDirector->RegisterAgent(First);
+            AIDirector->RegisterAgent(Second);
+            AIDirector->RegisterAgent(Third);
+
+            // Act
+            AIDirector->UnregisterAgent(First);
+
+            // Assert
+            TestEqual("Should have two agents", AIDirector->GetNumAgents(), 2);
+            TestFalse("Removed agent should be gone", AIDirector->IsAgentRegistered(First));
+            TestTrue("Second agent should remain", AIDirector->IsAgentRegistered(Second));
+            TestTrue("Third agent should remain", AIDirector->IsAgentRegistered(Third));
+        });
+
+        It("should ignore duplicate registrations", [this] {
+            // Arrange
+            ADDAIController* Controller = SpawnController();
+
+            // Act
+            AIDirector->RegisterAgent(Controller);
+            AIDirector->RegisterAgent(Controller);
+
+            // Assert
+            TestEqual("Should have one agent", AIDirector->GetNumAgents(), 1);
+        });
+
+        It("should unregister controllers when they end play", [this] {
+            // Arrange
+            ADDAIController* Controller = SpawnController();
+            AIDirector->RegisterAgent(Controller);
+
+            // Act
+            Controller->Destroy();
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestEqual("Should have no agents", AIDirector->GetNumAgents(), 0);
+        });
+
+        It("should register controllers when they possess an enemy", [this] {
+            // Act
+            const ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+
+            // Assert
+            TestNotNull("Enemy should be possessed", Controller);
+            TestTrue("Should register the controller", AIDirector->IsAgentRegistered(Controller));
+        });
+    });
+
+    Describe("Batched Decisions", [this] {
+        // The director is ticked by hand from here on, so the path requests it makes stay
+        // pending instead of being dispatched by the world tick
+        It("should target the crystal on an enemy's first decision", [this] {
+            // Arrange
+            const ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+            TestNotNull("Enemy should be possessed", Controller);
+
+            // Act
+            AIDirector->Tick(0.0f);
+
+            // Assert
+            TestEqual("Should move towards the target",
+                      AIDirector->GetState(Controller),
+                      EEnemyAIState::MovingTowardsTarget);
+            TestTrue("Should target the crystal",
+                     AIDirector->GetTarget(Controller) == Crystal->GetEntityHandle());
+        });
+
+        It("should send an enemy with a target to it", [this] {
+            // Arrange
+            const ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+            TestNotNull("Enemy should be possessed", Controller);
+            AIDirector->Tick(0.0f);
+
+            // Act
+            AIDirector->Tick(0.0f);
+
+            // Assert
+            TestEqual("Should still be moving",
+                      AIDirector->GetState(Controller),
+                      EEnemyAIState::MovingTowardsTarget);
+            TestTrue("Should request a path to the target",
+                     PathRequests->IsRequestPending(Controller));
+        });
+
+        It("should leave agents that cannot decide untouched", [this] {
+            // Arrange - no pawn, so the controller can never make decisions
+            ADDAIController* Controller = SpawnController();
+            AIDirector->RegisterAgent(Controller);
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 3);
+
+            // Assert
+            TestEqual("Should stay idle", AIDirector->GetState(Controller), EEnemyAIState::None);
+            TestFalse("Should have no target", AIDirector->GetTarget(Controller).IsValid());
+        });
+
+        It("should decide for large agent counts in parallel without losing agents", [this] {
+            // Arrange
+            TArray<ADDAIController*> Controllers;
+            for (int32 i = 0; i < 300; ++i) {
+                Controllers.Add(SpawnController());
+                AIDirector->RegisterAgent(Controllers.Last());
+            }
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 2);
+
+            // Assert
+            TestEqual("Should keep every agent", AIDirector->GetNumAgents(), 300);
+            for (const ADDAIController* Controller : Controllers) {
+                if (AIDirector->GetState(Controller) != EEnemyAIState::None) {
+                    AddError(TEXT("Agent without a pawn should not change state"));
+                    break;
+                }
+            }
+        });
+    });
+
+    Describe("Significance", [this] {
+        It("should let a high tier agent decide every tick", [this] {
+            // Arrange
+            ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+            if (!TestNotNull("Enemy should be possessed", Controller)) { return; }
+            Controller->GetAICharacter()->SetSignificanceTier(EAISignificanceTier::High);
+            AIDirector->Tick(0.0f);
+            AIDirector->ClearTarget(Controller);
+
+            // Act
+            AIDirector->Tick(0.0f);
+
+            // Assert
+            TestTrue("Should pick a target again",
+                     AIDirector->GetTarget(Controller) == Crystal->GetEntityHandle());
+        });
+
+        It("should skip a lower tier agent until its next decision time", [this] {
+            // Arrange
+            ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+            if (!TestNotNull("Enemy should be possessed", Controller)) { return; }
+            Controller->GetAICharacter()->SetSignificanceTier(EAISignificanceTier::Low);
+            AIDirector->Tick(0.0f);
+            AIDirector->ClearTarget(Controller);
+
+            // Act - world time hasn't moved since the last decision
+            AIDirector->Tick(0.0f);
+
+            // Assert
+            TestFalse("Should not decide again yet", AIDirector->GetTarget(Controller).IsValid());
+        });
+
+        It("should decide for a lower tier agent once its decision interval has passed", [this] {
+            // Arrange - the test world has no floor, keep the enemy in locomotion
+            ADDAIController* Controller = SpawnPossessedEnemy(FVector::ZeroVector);
+            if (!TestNotNull("Enemy should be possessed", Controller)) { return; }
+            ADDAICharacter* Character = Controller->GetAICharacter();
+            Character->GetCharacterMovement()->DisableMovement();
+            Character->SetSignificanceTier(EAISignificanceTier::Low);
+            AIDirector->Tick(0.0f);
+            AIDirector->ClearTarget(Controller);
+            const UWorld* World = BaseSpec.WorldHelper->GetWorld();
+            const double DecisionTime = World->GetTimeSeconds();
+            const float DecisionInterval = UAISignificanceManager::GetTierSettings(
+                EAISignificanceTier::Low).DecisionInterval;
+
+            // Act
+            const bool bDecided = FTestUtils::WaitForCondition(
+                BaseSpec.WorldHelper.Get(),
+                [this, Controller] { return AIDirector->GetTarget(Controller).IsValid(); },
+                DecisionInterval * 2.0f,
+                TEXT("next decision"));
+
+            // Assert
+            TestTrue("Should decide again", bDecided);
+            TestTrue("Should wait out the decision interval",
+                     World->GetTimeSeconds() - DecisionTime
+                     >= DecisionInterval - KINDA_SMALL_NUMBER);
+        });
+    });
+}
+
+ADDAIController* FAIDirectorManagerSpec::SpawnController() const {
+    return BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAIController>();
+}
+
+ADDAIController* FAIDirectorManagerSpec::SpawnPossessedEnemy(const FVector& Location) const {
+    UClass* EnemyClass = FTestUtils::LoadEnemyCharacterClass();
+    if (!EnemyClass) { return nullptr; }
+
+    // The enemy spawns its own controller, which registers with the director on possession
+    FActorSpawnParameters SpawnParameters;
+    SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    const ADDAICharacter* Enemy = BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAICharacter>(
+        EnemyClass,
+        FTransform(Location),
+        SpawnParameters);
+    return Enemy ? Cast<ADDAIController>(Enemy->GetController()) : nullptr;
+}
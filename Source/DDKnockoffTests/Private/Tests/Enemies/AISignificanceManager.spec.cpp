@@ -0,0 +1,256 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Tests/Common/TestUtils.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Enemies/AISignificanceManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/EngagementManager.h"
+#include "Entities/EntityManager.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Mocks/MockEnemy.h"
+
+BEGIN_DEFINE_SPEC(FAISignificanceManagerSpec,
+                  "DDKnockoff.Enemies.AISignificanceManager",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UAISignificanceManager> Significance;
+    TObjectPtr<UEngagementManager> Engagement;
+
+    ADDAICharacter* SpawnEnemy(const FVector& Location) const;
+    AMockEnemy* SpawnStructure(const FVector& Location) const;
+
+END_DEFINE_SPEC(FAISignificanceManagerSpec)
+
+void FAISignificanceManagerSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({
+            UEntityManager::StaticClass(),
+            UEngagementManager::StaticClass(),
+            UAISignificanceManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        UWorld* World = BaseSpec.WorldHelper->GetWorld();
+        Significance = UManagerHandlerSubsystem::GetManager<UAISignificanceManager>(World);
+        Engagement = UManagerHandlerSubsystem::GetManager<UEngagementManager>(World);
+        TestTrue("Significance should be available", Significance != nullptr);
+        TestTrue("Engagement should be available", Engagement != nullptr);
+    });
+
+    AfterEach([this] {
+        Significance = nullptr;
+        Engagement = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Tier Settings", [this] {
+        It("should run the high tier every frame", [this] {
+            // Act
+            const FAISignificanceTierSettings& Settings = UAISignificanceManager::GetTierSettings(
+                EAISignificanceTier::High);
+
+            // Assert
+            TestEqual("Should decide every frame", Settings.DecisionInterval, 0.0f);
+            TestEqual("Should poll overlaps every frame", Settings.OverlapPollInterval, 0.0f);
+            TestEqual("Should animate every frame", Settings.AnimationTickInterval, 0.0f);
+            TestEqual("Should move every frame", Settings.MovementTickInterval, 0.0f);
+        });
+
+        It("should never update a lower tier more often than a higher one", [this] {
+            for (int32 TierIndex = 1; TierIndex < static_cast<int32>(EAISignificanceTier::MAX);
+                 ++TierIndex) {
+                // Act
+                const FAISignificanceTierSettings& Higher = UAISignificanceManager::GetTierSettings(
+                    static_cast<EAISignificanceTier>(TierIndex - 1));
+                const FAISignificanceTierSettings& Lower = UAISignificanceManager::GetTierSettings(
+                    static_cast<EAISignificanceTier>(TierIndex));
+
+                // Assert
+                TestTrue("Should decide no more often",
+                         Lower.DecisionInterval >= Higher.DecisionInterval);
+                TestTrue("Should poll overlaps no more often",
+                         Lower.OverlapPollInterval >= Higher.OverlapPollInterval);
+                TestTrue("Should animate no more often",
+                         Lower.AnimationTickInterval >= Higher.AnimationTickInterval);
+                TestTrue("Should move no more often",
+                         Lower.MovementTickInterval >= Higher.MovementTickInterval);
+            }
+        });
+
+        It("should update the low tier less often than every frame", [this] {
+            // Act
+            const FAISignificanceTierSettings& Settings = UAISignificanceManager::GetTierSettings(
+                EAISignificanceTier::Low);
+
+            // Assert
+            TestTrue("Should throttle decisions", Settings.DecisionInterval > 0.0f);
+            TestTrue("Should throttle overlap polling", Settings.OverlapPollInterval > 0.0f);
+            TestTrue("Should throttle animation", Settings.AnimationTickInterval > 0.0f);
+            TestTrue("Should throttle movement", Settings.MovementTickInterval > 0.0f);
+        });
+    });
+
+    Describe("Tier Evaluation", [this] {
+        It("should rank an enemy overlapping a structure high", [this] {
+            // Arrange - the structure stands in medium range, its hurtbox reaches the enemy
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            AMockEnemy* Structure = SpawnStructure(FVector(3000.0, 0.0, 0.0));
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            FTestUtils::AddHurtbox(Structure, FVector(-3000.0, 0.0, 0.0));
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+            TestEqual("Enemy should be overlapping the structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::OverlappingStructure);
+
+            // Act
+            const EAISignificanceTier Tier = Significance->EvaluateTier(*Enemy, {});
+
+            // Assert
+            TestEqual("Should rank the enemy high", Tier, EAISignificanceTier::High);
+        });
+
+        It("should rank an enemy near a structure high", [this] {
+            // Arrange
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            SpawnStructure(FVector(1000.0, 0.0, 0.0));
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+
+            // Act
+            const EAISignificanceTier Tier = Significance->EvaluateTier(*Enemy, {});
+
+            // Assert
+            TestEqual("Should rank the enemy high", Tier, EAISignificanceTier::High);
+        });
+
+        It("should rank an off screen enemy near a camera medium", [this] {
+            // Arrange
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            SpawnStructure(FVector(10000.0, 0.0, 0.0));
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            const TArray<FVector> CameraLocations = {FVector(3000.0, 0.0, 0.0)};
+
+            // Act
+            const EAISignificanceTier Tier = Significance->EvaluateTier(*Enemy, CameraLocations);
+
+            // Assert
+            TestEqual("Should rank the enemy medium", Tier, EAISignificanceTier::Medium);
+        });
+
+        It("should rank an enemy far from structures and off screen low", [this] {
+            // Arrange
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            SpawnStructure(FVector(10000.0, 0.0, 0.0));
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+
+            // Act
+            const EAISignificanceTier Tier = Significance->EvaluateTier(*Enemy, {});
+
+            // Assert
+            TestEqual("Should rank the enemy low", Tier, EAISignificanceTier::Low);
+        });
+
+        It("should rank an enemy waiting for an attack slot low", [this] {
+            // Arrange - close enough to the structure to rank high otherwise
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            const AMockEnemy* Structure = SpawnStructure(FVector(1000.0, 0.0, 0.0));
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            ADDAIController* Controller = Cast<ADDAIController>(Enemy->GetController());
+            TestNotNull("Enemy should be possessed", Controller);
+            Engagement->SetSlotsPerStructure(1);
+            Engagement->RequestSlot(BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAIController>(),
+                                    Structure->GetEntityHandle());
+            Engagement->RequestSlot(Controller, Structure->GetEntityHandle());
+            TestTrue("Enemy should be waiting", Engagement->IsWaitingForSlot(Controller));
+
+            // Act
+            const EAISignificanceTier Tier = Significance->EvaluateTier(*Enemy, {});
+
+            // Assert
+            TestEqual("Should rank the enemy low", Tier, EAISignificanceTier::Low);
+        });
+    });
+
+    Describe("Applying Tiers", [this] {
+        It("should apply the tier's actor, mesh and movement tick intervals", [this] {
+            // Arrange
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            const FAISignificanceTierSettings& Settings = UAISignificanceManager::GetTierSettings(
+                EAISignificanceTier::Low);
+
+            // Act
+            Enemy->SetSignificanceTier(EAISignificanceTier::Low);
+
+            // Assert
+            TestEqual("Should store the tier",
+                      Enemy->GetSignificanceTier(),
+                      EAISignificanceTier::Low);
+            TestEqual("Should poll overlaps at the tier's rate",
+                      Enemy->GetActorTickInterval(),
+                      Settings.OverlapPollInterval);
+            TestEqual("Should animate at the tier's rate",
+                      Enemy->GetMesh()->GetComponentTickInterval(),
+                      Settings.AnimationTickInterval);
+            TestEqual("Should move at the tier's rate",
+                      Enemy->GetCharacterMovement()->GetComponentTickInterval(),
+                      Settings.MovementTickInterval);
+        });
+
+        It("should tick every frame again once back in the high tier", [this] {
+            // Arrange
+            ADDAICharacter* Enemy = SpawnEnemy(FVector::ZeroVector);
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            Enemy->SetSignificanceTier(EAISignificanceTier::Low);
+
+            // Act
+            Enemy->SetSignificanceTier(EAISignificanceTier::High);
+
+            // Assert
+            TestEqual("Should poll overlaps every frame", Enemy->GetActorTickInterval(), 0.0f);
+            TestEqual("Should animate every frame",
+                      Enemy->GetMesh()->GetComponentTickInterval(),
+                      0.0f);
+            TestEqual("Should move every frame",
+                      Enemy->GetCharacterMovement()->GetComponentTickInterval(),
+                      0.0f);
+        });
+    });
+}
+
+ADDAICharacter* FAISignificanceManagerSpec::SpawnEnemy(const FVector& Location) const {
+    UClass* EnemyClass = FTestUtils::LoadEnemyCharacterClass();
+    if (!EnemyClass) { return nullptr; }
+
+    FActorSpawnParameters SpawnParameters;
+    SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ADDAICharacter* Enemy = BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAICharacter>(
+        EnemyClass,
+        FTransform(Location),
+        SpawnParameters);
+
+    // The test world has no floor, so keep the enemy where the test put it
+    if (Enemy) { Enemy->GetCharacterMovement()->DisableMovement(); }
+    return Enemy;
+}
+
+AMockEnemy* FAISignificanceManagerSpec::SpawnStructure(const FVector& Location) const {
+    const FTransform Transform(Location);
+    AMockEnemy* Structure = BaseSpec.WorldHelper->GetWorld()->SpawnActorDeferred<AMockEnemy>(
+        AMockEnemy::StaticClass(),
+        Transform);
+    Structure->SetFaction(EFaction::Player);
+    Structure->SetEntityType(EEntityType::Structure_Defense);
+    Structure->FinishSpawning(Transform);
+    return Structure;
+}
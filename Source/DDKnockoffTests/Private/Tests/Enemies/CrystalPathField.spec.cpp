@@ -0,0 +1,249 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Enemies/CrystalPathField.h"
+
+BEGIN_DEFINE_SPEC(FCrystalPathFieldSpec,
+                  "DDKnockoff.Enemies.CrystalPathField",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    FCrystalPathField Field;
+
+    const FEntityHandle LeftCrystal = FEntityHandle(1, 1);
+    const FEntityHandle RightCrystal = FEntityHandle(2, 1);
+
+    /** World location of the center of a grid cell */
+    static FVector CellLocation(const int32 X, const int32 Y) {
+        return FVector(X * 100.0 + 50.0, Y * 100.0 + 50.0, 0.0);
+    }
+
+END_DEFINE_SPEC(FCrystalPathFieldSpec)
+
+void FCrystalPathFieldSpec::Define() {
+    BeforeEach([this] {
+        // 10x10 grid of 100 unit cells
+        Field.Reset(FBox(FVector(0.0, 0.0, -50.0), FVector(1000.0, 1000.0, 50.0)), 100.0f);
+    });
+
+    Describe("Grid", [this] {
+        It("should size the grid to the bounds", [this] {
+            // Assert
+            TestEqual("Should be 10 cells wide", Field.GetGridSize().X, 10);
+            TestEqual("Should be 10 cells deep", Field.GetGridSize().Y, 10);
+            TestEqual("Should have 100 cells", Field.Num(), 100);
+        });
+
+        It("should map locations outside the grid to no cell", [this] {
+            // Assert
+            TestEqual("Should reject locations before the origin",
+                      Field.GetCellIndex(FVector(-10.0, 50.0, 0.0)),
+                      INDEX_NONE);
+            TestEqual("Should reject locations past the far edge",
+                      Field.GetCellIndex(FVector(50.0, 1010.0, 0.0)),
+                      INDEX_NONE);
+        });
+    });
+
+    Describe("Sampling", [this] {
+        It("should resolve each location to its closest crystal", [this] {
+            // Arrange
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}, {CellLocation(9, 9), RightCrystal}});
+
+            // Act
+            FEntityHandle NearLeft;
+            FEntityHandle NearRight;
+            float LeftCost = 0.0f;
+            float RightCost = 0.0f;
+            const bool bFoundLeft = Field.Sample(CellLocation(1, 1), NearLeft, LeftCost);
+            const bool bFoundRight = Field.Sample(CellLocation(8, 8), NearRight, RightCost);
+
+            // Assert
+            TestTrue("Should find a crystal near the left", bFoundLeft);
+            TestTrue("Should find a crystal near the right", bFoundRight);
+            TestEqual("Should pick the left crystal", NearLeft, LeftCrystal);
+            TestEqual("Should pick the right crystal", NearRight, RightCrystal);
+            TestEqual("Should cost one diagonal step", LeftCost, 100.0f * UE_SQRT_2, 0.01f);
+        });
+
+        It("should route around blocked cells", [this] {
+            // Arrange - wall at column 5 with a gap only in the last row
+            for (int32 Y = 0; Y < 9; ++Y) {
+                Field.SetCellCost(Field.GetCellIndex(CellLocation(5, Y)),
+                                  FCrystalPathField::BlockedCost);
+            }
+            Field.Solve({{CellLocation(4, 0), LeftCrystal}, {CellLocation(9, 0), RightCrystal}});
+
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            Field.Sample(CellLocation(6, 0), Crystal, Cost);
+
+            // Assert
+            TestEqual("Should pick the crystal on its side of the wall", Crystal, RightCrystal);
+            TestEqual("Should cost three straight steps", Cost, 300.0f, 0.01f);
+        });
+
+        It("should prefer a farther crystal over walking through expensive cells", [this] {
+            // Arrange
+            for (int32 Y = 0; Y < 10; ++Y) {
+                Field.SetCellCost(Field.GetCellIndex(CellLocation(5, Y)), 100.0f);
+            }
+            Field.Solve({{CellLocation(4, 0), LeftCrystal}, {CellLocation(9, 0), RightCrystal}});
+
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            Field.Sample(CellLocation(6, 0), Crystal, Cost);
+
+            // Assert
+            TestEqual("Should avoid the expensive column", Crystal, RightCrystal);
+        });
+
+        It("should fall back to a neighbouring cell when sampled on a blocked cell", [this] {
+            // Arrange
+            Field.SetCellCost(Field.GetCellIndex(CellLocation(2, 0)),
+                              FCrystalPathField::BlockedCost);
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            const bool bFound = Field.Sample(CellLocation(2, 0), Crystal, Cost);
+
+            // Assert
+            TestTrue("Should still find a crystal", bFound);
+            TestEqual("Should pick the only crystal", Crystal, LeftCrystal);
+        });
+
+        It("should report no crystal when none can be reached", [this] {
+            // Arrange - the only crystal sits on a blocked cell
+            Field.SetCellCost(Field.GetCellIndex(CellLocation(0, 0)),
+                              FCrystalPathField::BlockedCost);
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            const bool bFound = Field.Sample(CellLocation(5, 5), Crystal, Cost);
+
+            // Assert
+            TestFalse("Should not find a crystal", bFound);
+            TestFalse("Should leave the handle unset", Crystal.IsValid());
+        });
+
+        It("should not answer before the field is solved", [this] {
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            const bool bFound = Field.Sample(CellLocation(5, 5), Crystal, Cost);
+
+            // Assert
+            TestFalse("Should not find a crystal", bFound);
+        });
+    });
+
+    Describe("Incremental Solving", [this] {
+        It("should match a one-shot solve once finished", [this] {
+            // Arrange
+            for (int32 Y = 0; Y < 9; ++Y) {
+                Field.SetCellCost(Field.GetCellIndex(CellLocation(5, Y)), 4.0f);
+            }
+            FCrystalPathField OneShot = Field;
+            OneShot.Solve({{CellLocation(0, 0), LeftCrystal}, {CellLocation(9, 9), RightCrystal}});
+
+            // Act
+            Field.BeginSolve({{CellLocation(0, 0), LeftCrystal}, {CellLocation(9, 9), RightCrystal}});
+            int32 NumSteps = 1;
+            while (!Field.StepSolve(8)) { ++NumSteps; }
+
+            // Assert
+            TestTrue("Should take several steps", NumSteps > 1);
+            TestFalse("Should no longer be solving", Field.IsSolving());
+            for (int32 CellIndex = 0; CellIndex < Field.Num(); ++CellIndex) {
+                FEntityHandle Crystal;
+                FEntityHandle OneShotCrystal;
+                float Cost = 0.0f;
+                float OneShotCost = 0.0f;
+                Field.Sample(Field.GetCellCenter(CellIndex), Crystal, Cost);
+                OneShot.Sample(Field.GetCellCenter(CellIndex), OneShotCrystal, OneShotCost);
+                TestEqual("Should pick the same crystal", Crystal, OneShotCrystal);
+                TestEqual("Should find the same cost", Cost, OneShotCost, 0.01f);
+            }
+        });
+
+        It("should keep answering from the previous solve until finished", [this] {
+            // Arrange
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            Field.BeginSolve({{CellLocation(9, 9), RightCrystal}});
+            Field.StepSolve(1);
+
+            // Assert
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            TestTrue("Should still be solving", Field.IsSolving());
+            TestTrue("Should still answer", Field.Sample(CellLocation(8, 8), Crystal, Cost));
+            TestEqual("Should answer with the previous crystal", Crystal, LeftCrystal);
+        });
+
+        It("should not charge the cost of a crystal's own cell", [this] {
+            // Arrange - crystals sit in an obstacle area with a huge cost
+            Field.SetCellCost(Field.GetCellIndex(CellLocation(0, 0)), 1000000.0f);
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FEntityHandle Crystal;
+            float Cost = 0.0f;
+            Field.Sample(CellLocation(2, 0), Crystal, Cost);
+
+            // Assert
+            TestEqual("Should cost two straight steps", Cost, 200.0f, 0.01f);
+        });
+    });
+
+    Describe("Flow Direction", [this] {
+        It("should point along the cheapest route to the crystal", [this] {
+            // Arrange
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FVector Direction;
+            const bool bFound = Field.GetFlowDirection(CellLocation(5, 0), Direction);
+
+            // Assert
+            TestTrue("Should find a direction", bFound);
+            TestEqual("Should head straight for the crystal", Direction, FVector(-1.0, 0.0, 0.0));
+        });
+
+        It("should stop on the crystal's cell", [this] {
+            // Arrange
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FVector Direction = FVector::OneVector;
+            const bool bFound = Field.GetFlowDirection(CellLocation(0, 0), Direction);
+
+            // Assert
+            TestTrue("Should still report the crystal as reachable", bFound);
+            TestTrue("Should not steer anywhere", Direction.IsZero());
+        });
+
+        It("should steer around blocked cells towards the gap", [this] {
+            // Arrange - wall at column 5 with a gap only in the last row
+            for (int32 Y = 0; Y < 9; ++Y) {
+                Field.SetCellCost(Field.GetCellIndex(CellLocation(5, Y)),
+                                  FCrystalPathField::BlockedCost);
+            }
+            Field.Solve({{CellLocation(0, 0), LeftCrystal}});
+
+            // Act
+            FVector Direction;
+            Field.GetFlowDirection(CellLocation(6, 0), Direction);
+
+            // Assert
+            TestTrue("Should head towards the gap", Direction.Y > 0.0);
+            TestTrue("Should not walk into the wall", Direction.X >= 0.0);
+        });
+    });
+}
@@ -0,0 +1,303 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Tests/Common/TestUtils.h"
+#include "Components/BoxComponent.h"
+#include "Enemies/DDAICharacter.h"
+#include "Entities/EntityManager.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Mocks/MockEnemy.h"
+
+BEGIN_DEFINE_SPEC(FDDAICharacterSpec,
+                  "DDKnockoff.Enemies.DDAICharacter",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UEntityManager> EntityManager;
+
+    /** Spawn enemies here, structures reach it with hurtboxes from wherever they stand */
+    const FVector EnemyLocation = FVector::ZeroVector;
+
+    ADDAICharacter* SpawnEnemy() const;
+    AMockEnemy* SpawnStructure(const FVector& Location) const;
+    UBoxComponent* AddHurtboxOnEnemy(AMockEnemy* Structure) const;
+    AMockEnemy* SpawnOverlappingStructure(const FVector& Location) const;
+    void TickFrame() const;
+
+END_DEFINE_SPEC(FDDAICharacterSpec)
+
+void FDDAICharacterSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({UEntityManager::StaticClass()});
+        // SPEC_BOILERPLATE_END
+
+        EntityManager = UManagerHandlerSubsystem::GetManager<UEntityManager>(
+            BaseSpec.WorldHelper->GetWorld());
+        TestTrue("EntityManager should be available", EntityManager != nullptr);
+    });
+
+    AfterEach([this] {
+        EntityManager = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Overlap Tracking", [this] {
+        It("should target the closest of two overlapping structures", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            const AMockEnemy* Closer = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+
+            // Act
+            TickFrame();
+
+            // Assert
+            TestEqual("Should be overlapping a structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::OverlappingStructure);
+            TestTrue("Should target the closer structure",
+                     Enemy->GetClosestOverlappingStructure() == Closer->GetEntityHandle());
+        });
+
+        It("should move to the other structure when the closest stops overlapping", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Closer = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            const AMockEnemy* Further = SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+            TickFrame();
+
+            // Act
+            Closer->SetActorLocation(FVector(10000.0, 0.0, 0.0));
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the remaining structure",
+                     Enemy->GetClosestOverlappingStructure() == Further->GetEntityHandle());
+        });
+
+        It("should stop overlapping once every structure has left", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* First = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            AMockEnemy* Second = SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+            TickFrame();
+
+            // Act
+            First->SetActorLocation(FVector(10000.0, 0.0, 0.0));
+            Second->SetActorLocation(FVector(-10000.0, 0.0, 0.0));
+            TickFrame();
+
+            // Assert
+            TestEqual("Should not be overlapping a structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::None);
+        });
+
+        It("should retarget when the closest structure stops being targetable", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            const AMockEnemy* Closer = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            const AMockEnemy* Further = SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+            TickFrame();
+
+            // Act
+            EntityManager->SetEntityTargetable(Closer->GetEntityHandle(), false);
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the targetable structure",
+                     Enemy->GetClosestOverlappingStructure() == Further->GetEntityHandle());
+        });
+
+        It("should go back to the closest structure once it is targetable again", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            const AMockEnemy* Closer = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+            TickFrame();
+            EntityManager->SetEntityTargetable(Closer->GetEntityHandle(), false);
+            TickFrame();
+
+            // Act
+            EntityManager->SetEntityTargetable(Closer->GetEntityHandle(), true);
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the closer structure again",
+                     Enemy->GetClosestOverlappingStructure() == Closer->GetEntityHandle());
+        });
+    });
+
+    Describe("Overlap Edge Cases", [this] {
+        It("should keep a structure while another of its hurtboxes still overlaps", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Structure = SpawnStructure(FVector(200.0, 0.0, 0.0));
+            UBoxComponent* FirstHurtbox = AddHurtboxOnEnemy(Structure);
+            AddHurtboxOnEnemy(Structure);
+            TickFrame();
+
+            // Act
+            FirstHurtbox->SetRelativeLocation(FVector(10000.0, 0.0, 0.0));
+            TickFrame();
+
+            // Assert
+            TestEqual("Should still be overlapping the structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::OverlappingStructure);
+            TestTrue("Should still target the structure",
+                     Enemy->GetClosestOverlappingStructure() == Structure->GetEntityHandle());
+        });
+
+        It("should let go of a structure once its last hurtbox stops overlapping", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Structure = SpawnStructure(FVector(200.0, 0.0, 0.0));
+            UBoxComponent* FirstHurtbox = AddHurtboxOnEnemy(Structure);
+            UBoxComponent* SecondHurtbox = AddHurtboxOnEnemy(Structure);
+            TickFrame();
+
+            // Act
+            FirstHurtbox->SetRelativeLocation(FVector(10000.0, 0.0, 0.0));
+            SecondHurtbox->SetRelativeLocation(FVector(-10000.0, 0.0, 0.0));
+            TickFrame();
+
+            // Assert
+            TestEqual("Should not be overlapping a structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::None);
+        });
+
+        It("should target a structure once it becomes targetable", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Structure = SpawnStructure(FVector(200.0, 0.0, 0.0));
+            EntityManager->SetEntityTargetable(Structure->GetEntityHandle(), false);
+            AddHurtboxOnEnemy(Structure);
+            TickFrame();
+            TestEqual("Should ignore the untargetable structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::None);
+
+            // Act - no overlap event follows, the structure was already overlapping
+            EntityManager->SetEntityTargetable(Structure->GetEntityHandle(), true);
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the structure",
+                     Enemy->GetClosestOverlappingStructure() == Structure->GetEntityHandle());
+        });
+
+        It("should target a structure once it is registered", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Structure = SpawnStructure(FVector(200.0, 0.0, 0.0));
+            EntityManager->UnregisterEntity(Structure);
+            AddHurtboxOnEnemy(Structure);
+            TickFrame();
+            TestEqual("Should ignore the unregistered structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::None);
+
+            // Act
+            EntityManager->RegisterEntity(Structure);
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the structure",
+                     Enemy->GetClosestOverlappingStructure() == Structure->GetEntityHandle());
+        });
+
+        It("should drop a targeted structure that gets unregistered", [this] {
+            // Arrange
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+            AMockEnemy* Closer = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            const AMockEnemy* Further = SpawnOverlappingStructure(FVector(400.0, 0.0, 0.0));
+            TickFrame();
+
+            // Act
+            EntityManager->UnregisterEntity(Closer);
+            TickFrame();
+
+            // Assert
+            TestTrue("Should target the registered structure",
+                     Enemy->GetClosestOverlappingStructure() == Further->GetEntityHandle());
+        });
+
+        It("should target structures it already overlaps when spawned", [this] {
+            // Arrange - the overlap begins before BeginPlay binds the overlap events
+            const AMockEnemy* Structure = SpawnOverlappingStructure(FVector(200.0, 0.0, 0.0));
+            const ADDAICharacter* Enemy = SpawnEnemy();
+            if (!TestNotNull("Enemy should spawn", Enemy)) { return; }
+
+            // Act
+            TickFrame();
+
+            // Assert
+            TestEqual("Should be overlapping a structure",
+                      Enemy->GetActorOverlapState(),
+                      CharacterActorOverlapState::OverlappingStructure);
+            TestTrue("Should target the structure",
+                     Enemy->GetClosestOverlappingStructure() == Structure->GetEntityHandle());
+        });
+    });
+}
+
+ADDAICharacter* FDDAICharacterSpec::SpawnEnemy() const {
+    UClass* EnemyClass = FTestUtils::LoadEnemyCharacterClass();
+    if (!EnemyClass) { return nullptr; }
+
+    FActorSpawnParameters SpawnParameters;
+    SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ADDAICharacter* Enemy = BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAICharacter>(
+        EnemyClass,
+        FTransform(EnemyLocation),
+        SpawnParameters);
+
+    // The test world has no floor, so keep the enemy where its overlaps are
+    if (Enemy) { Enemy->GetCharacterMovement()->DisableMovement(); }
+    return Enemy;
+}
+
+AMockEnemy* FDDAICharacterSpec::SpawnStructure(const FVector& Location) const {
+    const FTransform Transform(Location);
+    AMockEnemy* Structure = BaseSpec.WorldHelper->GetWorld()->SpawnActorDeferred<AMockEnemy>(
+        AMockEnemy::StaticClass(),
+        Transform);
+    Structure->SetFaction(EFaction::Player);
+    Structure->SetEntityType(EEntityType::Structure_Defense);
+    Structure->FinishSpawning(Transform);
+    return Structure;
+}
+
+UBoxComponent* FDDAICharacterSpec::AddHurtboxOnEnemy(AMockEnemy* Structure) const {
+    // Structures are scored by where they stand, so only the hurtbox reaches over
+    return FTestUtils::AddHurtbox(Structure, EnemyLocation - Structure->GetActorLocation());
+}
+
+AMockEnemy* FDDAICharacterSpec::SpawnOverlappingStructure(const FVector& Location) const {
+    AMockEnemy* Structure = SpawnStructure(Location);
+    AddHurtboxOnEnemy(Structure);
+    return Structure;
+}
+
+void FDDAICharacterSpec::TickFrame() const {
+    FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+}
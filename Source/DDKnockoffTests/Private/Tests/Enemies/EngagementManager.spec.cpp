@@ -0,0 +1,163 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/EngagementManager.h"
+
+BEGIN_DEFINE_SPEC(FEngagementManagerSpec,
+                  "DDKnockoff.Enemies.EngagementManager",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UEngagementManager> Engagement;
+
+    const FEntityHandle Structure = FEntityHandle(1, 1);
+    const FEntityHandle OtherStructure = FEntityHandle(2, 1);
+
+    ADDAIController* SpawnController() const;
+
+END_DEFINE_SPEC(FEngagementManagerSpec)
+
+void FEngagementManagerSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({
+            UEngagementManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        Engagement = UManagerHandlerSubsystem::GetManager<UEngagementManager>(BaseSpec.WorldHelper->GetWorld());
+        TestTrue("Engagement should be available", Engagement != nullptr);
+        Engagement->SetSlotsPerStructure(2);
+    });
+
+    AfterEach([this] {
+        Engagement = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Slots", [this] {
+        It("should hand out slots until the structure is full", [this] {
+            // Arrange
+            ADDAIController* First = SpawnController();
+            ADDAIController* Second = SpawnController();
+            ADDAIController* Third = SpawnController();
+
+            // Act
+            const bool bFirstGranted = Engagement->RequestSlot(First, Structure);
+            const bool bSecondGranted = Engagement->RequestSlot(Second, Structure);
+            const bool bThirdGranted = Engagement->RequestSlot(Third, Structure);
+
+            // Assert
+            TestTrue("First should get a slot", bFirstGranted);
+            TestTrue("Second should get a slot", bSecondGranted);
+            TestFalse("Third should not get a slot", bThirdGranted);
+            TestTrue("Third should be waiting", Engagement->IsWaitingForSlot(Third));
+            TestEqual("Should fill both slots", Engagement->GetNumSlotHolders(Structure), 2);
+            TestEqual("Should queue one enemy", Engagement->GetQueueLength(Structure), 1);
+        });
+
+        It("should keep slots per structure", [this] {
+            // Arrange
+            Engagement->RequestSlot(SpawnController(), Structure);
+            Engagement->RequestSlot(SpawnController(), Structure);
+
+            // Act
+            const bool bGranted = Engagement->RequestSlot(SpawnController(), OtherStructure);
+
+            // Assert
+            TestTrue("Should get a slot at the other structure", bGranted);
+        });
+
+        It("should move an enemy that asks for a different structure", [this] {
+            // Arrange
+            ADDAIController* Controller = SpawnController();
+            Engagement->RequestSlot(Controller, Structure);
+
+            // Act
+            Engagement->RequestSlot(Controller, OtherStructure);
+
+            // Assert
+            TestEqual("Should free the first structure", Engagement->GetNumSlotHolders(Structure), 0);
+            TestEqual("Should hold the other structure", Engagement->GetNumSlotHolders(OtherStructure), 1);
+        });
+    });
+
+    Describe("Queue", [this] {
+        It("should promote waiting enemies in arrival order", [this] {
+            // Arrange
+            ADDAIController* Holder = SpawnController();
+            Engagement->RequestSlot(Holder, Structure);
+            Engagement->RequestSlot(SpawnController(), Structure);
+            ADDAIController* FirstWaiting = SpawnController();
+            ADDAIController* SecondWaiting = SpawnController();
+            Engagement->RequestSlot(FirstWaiting, Structure);
+            Engagement->RequestSlot(SecondWaiting, Structure);
+
+            // Act
+            Engagement->ReleaseSlot(Holder);
+
+            // Assert
+            TestTrue("First waiting enemy should get the slot", Engagement->HasSlot(FirstWaiting));
+            TestTrue("Second waiting enemy should keep waiting",
+                     Engagement->IsWaitingForSlot(SecondWaiting));
+            TestFalse("Released enemy should be disengaged", Engagement->HasSlot(Holder));
+        });
+
+        It("should not let a newcomer jump the queue", [this] {
+            // Arrange
+            ADDAIController* Holder = SpawnController();
+            Engagement->RequestSlot(Holder, Structure);
+            Engagement->RequestSlot(SpawnController(), Structure);
+            ADDAIController* Waiting = SpawnController();
+            Engagement->RequestSlot(Waiting, Structure);
+            Engagement->ReleaseSlot(Holder);
+
+            // Act
+            const bool bNewcomerGranted = Engagement->RequestSlot(SpawnController(), Structure);
+
+            // Assert
+            TestTrue("Waiting enemy should hold the freed slot", Engagement->HasSlot(Waiting));
+            TestFalse("Newcomer should queue", bNewcomerGranted);
+        });
+
+        It("should drop a waiting enemy that gives up", [this] {
+            // Arrange
+            Engagement->RequestSlot(SpawnController(), Structure);
+            Engagement->RequestSlot(SpawnController(), Structure);
+            ADDAIController* Waiting = SpawnController();
+            Engagement->RequestSlot(Waiting, Structure);
+
+            // Act
+            Engagement->ReleaseSlot(Waiting);
+
+            // Assert
+            TestEqual("Should empty the queue", Engagement->GetQueueLength(Structure), 0);
+            TestFalse("Should no longer be waiting", Engagement->IsWaitingForSlot(Waiting));
+        });
+
+        It("should promote waiting enemies when slots are added", [this] {
+            // Arrange
+            Engagement->RequestSlot(SpawnController(), Structure);
+            Engagement->RequestSlot(SpawnController(), Structure);
+            ADDAIController* Waiting = SpawnController();
+            Engagement->RequestSlot(Waiting, Structure);
+
+            // Act
+            Engagement->SetSlotsPerStructure(3);
+
+            // Assert
+            TestTrue("Waiting enemy should get the new slot", Engagement->HasSlot(Waiting));
+        });
+    });
+}
+
+ADDAIController* FEngagementManagerSpec::SpawnController() const {
+    return BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAIController>();
+}
@@ -0,0 +1,243 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Tests/Common/TestUtils.h"
+#include "Enemies/CrystalPathFieldManager.h"
+#include "Enemies/DDAICharacter.h"
+#include "Enemies/FlowFieldMovementManager.h"
+#include "Entities/EntityManager.h"
+#include "Mocks/MockEnemy.h"
+
+BEGIN_DEFINE_SPEC(FFlowFieldMovementManagerSpec,
+                  "DDKnockoff.Enemies.FlowFieldMovementManager",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UFlowFieldMovementManager> FlowFieldMovement;
+    TObjectPtr<UCrystalPathFieldManager> CrystalPathField;
+    TObjectPtr<AMockEnemy> Crystal;
+    UClass* EnemyClass;
+
+    AMockEnemy* SpawnEntity(const FVector& Location, EFaction Faction, EEntityType Type) const;
+    ADDAICharacter* SpawnAgent(const FVector& Location) const;
+    bool WaitForGoalField() const;
+
+END_DEFINE_SPEC(FFlowFieldMovementManagerSpec)
+
+void FFlowFieldMovementManagerSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({
+            UEntityManager::StaticClass(),
+            UCrystalPathFieldManager::StaticClass(),
+            UFlowFieldMovementManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        UWorld* World = BaseSpec.WorldHelper->GetWorld();
+        FlowFieldMovement = UManagerHandlerSubsystem::GetManager<UFlowFieldMovementManager>(World);
+        CrystalPathField = UManagerHandlerSubsystem::GetManager<UCrystalPathFieldManager>(World);
+        TestTrue("Flow field movement should be available", FlowFieldMovement != nullptr);
+        TestTrue("Crystal path field should be available", CrystalPathField != nullptr);
+
+        EnemyClass = FTestUtils::LoadEnemyCharacterClass();
+        TestTrue("Enemy class should be configured", EnemyClass != nullptr);
+
+        // The test world has no navmesh, so lay an open grid around a crystal to the +X side
+        Crystal = SpawnEntity(FVector(1000.0, 0.0, 0.0),
+                              EFaction::Player,
+                              EEntityType::Structure_Crystal);
+        CrystalPathField->ResetGridForTesting(
+            FBox(FVector(-2000.0, -2000.0, -100.0), FVector(2000.0, 2000.0, 100.0)));
+        TestTrue("Field should be solved",
+                 FTestUtils::WaitForCondition(BaseSpec.WorldHelper.Get(),
+                                              [this] { return CrystalPathField->IsFieldReady(); },
+                                              1.0f,
+                                              TEXT("crystal path field")));
+    });
+
+    AfterEach([this] {
+        FlowFieldMovement = nullptr;
+        CrystalPathField = nullptr;
+        Crystal = nullptr;
+        EnemyClass = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("Agent Registration", [this] {
+        It("should follow a crystal goal", [this] {
+            // Arrange
+            ADDAICharacter* Agent = SpawnAgent(FVector::ZeroVector);
+
+            // Act
+            const bool bFollowing = FlowFieldMovement->SetAgentGoal(Agent,
+                                                                    Crystal->GetEntityHandle());
+
+            // Assert
+            TestTrue("Should accept the goal", bFollowing);
+            TestTrue("Should be following", FlowFieldMovement->IsAgentFollowing(Agent));
+            TestEqual("Should have one agent", FlowFieldMovement->GetNumAgents(), 1);
+        });
+
+        It("should refuse goals that are not crystals", [this] {
+            // Arrange
+            ADDAICharacter* Agent = SpawnAgent(FVector::ZeroVector);
+            const AMockEnemy* Defense = SpawnEntity(FVector(500.0, 0.0, 0.0),
+                                                    EFaction::Player,
+                                                    EEntityType::Structure_Defense);
+
+            // Act
+            const bool bFollowing = FlowFieldMovement->SetAgentGoal(Agent,
+                                                                    Defense->GetEntityHandle());
+
+            // Assert
+            TestFalse("Should refuse the goal", bFollowing);
+            TestFalse("Should not be following", FlowFieldMovement->IsAgentFollowing(Agent));
+        });
+
+        It("should keep other agents registered after a swap-removal", [this] {
+            // Arrange
+            ADDAICharacter* First = SpawnAgent(FVector(0.0, -400.0, 0.0));
+            ADDAICharacter* Second = SpawnAgent(FVector::ZeroVector);
+            ADDAICharacter* Third = SpawnAgent(FVector(0.0, 400.0, 0.0));
+            for (ADDAICharacter* Agent : {First, Second, Third}) {
+                FlowFieldMovement->SetAgentGoal(Agent, Crystal->GetEntityHandle());
+            }
+
+            // Act
+            FlowFieldMovement->RemoveAgent(First);
+
+            // Assert
+            TestEqual("Should have two agents", FlowFieldMovement->GetNumAgents(), 2);
+            TestFalse("Removed agent should be gone", FlowFieldMovement->IsAgentFollowing(First));
+            TestTrue("Second agent should remain", FlowFieldMovement->IsAgentFollowing(Second));
+            TestTrue("Third agent should remain", FlowFieldMovement->IsAgentFollowing(Third));
+        });
+
+        It("should drop destroyed characters", [this] {
+            // Arrange
+            ADDAICharacter* Agent = SpawnAgent(FVector::ZeroVector);
+            FlowFieldMovement->SetAgentGoal(Agent, Crystal->GetEntityHandle());
+
+            // Act
+            Agent->Destroy();
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestEqual("Should have no agents", FlowFieldMovement->GetNumAgents(), 0);
+        });
+    });
+
+    Describe("Goal Fields", [this] {
+        It("should solve goal fields in the rebuild job", [this] {
+            // Arrange
+            ADDAICharacter* Agent = SpawnAgent(FVector::ZeroVector);
+
+            // Act
+            FlowFieldMovement->SetAgentGoal(Agent, Crystal->GetEntityHandle());
+
+            // Assert
+            TestNull("Should not solve on request",
+                     CrystalPathField->GetGoalField(Crystal->GetEntityHandle()));
+            TestTrue("Should queue the solve", CrystalPathField->IsRebuildPending());
+            TestTrue("Should solve the goal field", WaitForGoalField());
+        });
+    });
+
+    Describe("Steering", [this] {
+        It("should steer a lone agent towards its goal", [this] {
+            // Arrange
+            ADDAICharacter* Agent = SpawnAgent(FVector::ZeroVector);
+            FlowFieldMovement->SetAgentGoal(Agent, Crystal->GetEntityHandle());
+            WaitForGoalField();
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            const FVector Direction = FlowFieldMovement->GetAgentDirection(Agent);
+            TestEqual("Should move at full input", Direction.Size(), 1.0, 0.01);
+            TestTrue("Should head for the crystal", Direction.X > 0.9);
+        });
+
+        It("should push neighbouring agents apart", [this] {
+            // Arrange - side by side across the flow, inside the separation radius
+            ADDAICharacter* Left = SpawnAgent(FVector(0.0, -40.0, 0.0));
+            ADDAICharacter* Right = SpawnAgent(FVector(0.0, 40.0, 0.0));
+            FlowFieldMovement->SetAgentGoal(Left, Crystal->GetEntityHandle());
+            FlowFieldMovement->SetAgentGoal(Right, Crystal->GetEntityHandle());
+            WaitForGoalField();
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            const FVector LeftDirection = FlowFieldMovement->GetAgentDirection(Left);
+            const FVector RightDirection = FlowFieldMovement->GetAgentDirection(Right);
+            TestTrue("Left agent should be pushed left", LeftDirection.Y < 0.0);
+            TestTrue("Right agent should be pushed right", RightDirection.Y > 0.0);
+            TestEqual("Separation should be symmetric",
+                      LeftDirection.Y,
+                      -RightDirection.Y,
+                      0.05);
+            TestTrue("Left agent should still head for the crystal", LeftDirection.X > 0.0);
+            TestTrue("Right agent should still head for the crystal", RightDirection.X > 0.0);
+        });
+
+        It("should not push apart agents beyond the separation radius", [this] {
+            // Arrange
+            ADDAICharacter* Left = SpawnAgent(FVector(0.0, -400.0, 0.0));
+            ADDAICharacter* Right = SpawnAgent(FVector(0.0, 400.0, 0.0));
+            FlowFieldMovement->SetAgentGoal(Left, Crystal->GetEntityHandle());
+            FlowFieldMovement->SetAgentGoal(Right, Crystal->GetEntityHandle());
+            WaitForGoalField();
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            const FVector LeftDirection = FlowFieldMovement->GetAgentDirection(Left);
+            TestTrue("Should only follow the flow", LeftDirection.Y >= 0.0);
+        });
+    });
+}
+
+AMockEnemy* FFlowFieldMovementManagerSpec::SpawnEntity(const FVector& Location,
+                                                       const EFaction Faction,
+                                                       const EEntityType Type) const {
+    // Deferred so the type is set before BeginPlay registers the entity
+    AMockEnemy* Entity = BaseSpec.WorldHelper->GetWorld()->SpawnActorDeferred<AMockEnemy>(
+        AMockEnemy::StaticClass(),
+        FTransform(Location));
+    Entity->SetFaction(Faction);
+    Entity->SetEntityType(Type);
+    Entity->FinishSpawning(FTransform(Location));
+    return Entity;
+}
+
+ADDAICharacter* FFlowFieldMovementManagerSpec::SpawnAgent(const FVector& Location) const {
+    // No controller, the tests drive the goals the AI director would set
+    ADDAICharacter* Agent = BaseSpec.WorldHelper->GetWorld()->SpawnActorDeferred<ADDAICharacter>(
+        EnemyClass,
+        FTransform(Location),
+        nullptr,
+        nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    Agent->AutoPossessAI = EAutoPossessAI::Disabled;
+    Agent->FinishSpawning(FTransform(Location));
+    return Agent;
+}
+
+bool FFlowFieldMovementManagerSpec::WaitForGoalField() const {
+    return FTestUtils::WaitForCondition(
+        BaseSpec.WorldHelper.Get(),
+        [this] { return CrystalPathField->GetGoalField(Crystal->GetEntityHandle()) != nullptr; },
+        1.0f,
+        TEXT("goal field"));
+}
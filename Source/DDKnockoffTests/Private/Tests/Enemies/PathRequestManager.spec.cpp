@@ -0,0 +1,128 @@
+#include "CoreMinimal.h"
+#include "Tests/Common/BaseSpec.h"
+#include "Enemies/DDAIController.h"
+#include "Enemies/PathRequestManager.h"
+
+BEGIN_DEFINE_SPEC(FPathRequestManagerSpec,
+                  "DDKnockoff.Enemies.PathRequestManager",
+                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                  EAutomationTestFlags::ProductFilter)
+
+    // SPEC_BOILERPLATE_BEGIN
+    BaseSpec BaseSpec;
+    // SPEC_BOILERPLATE_END
+
+    TObjectPtr<UPathRequestManager> PathRequests;
+    FNavAgentProperties AgentProperties;
+
+    ADDAIController* SpawnController() const;
+    AActor* SpawnGoal() const;
+
+END_DEFINE_SPEC(FPathRequestManagerSpec)
+
+void FPathRequestManagerSpec::Define() {
+    BeforeEach([this] {
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.SetupBaseSpecEnvironment({
+            UPathRequestManager::StaticClass()
+        });
+        // SPEC_BOILERPLATE_END
+
+        PathRequests = UManagerHandlerSubsystem::GetManager<UPathRequestManager>(BaseSpec.WorldHelper->GetWorld());
+        TestTrue("PathRequests should be available", PathRequests != nullptr);
+    });
+
+    AfterEach([this] {
+        PathRequests = nullptr;
+
+        // SPEC_BOILERPLATE_BEGIN
+        BaseSpec.TeardownBaseSpecEnvironment();
+        // SPEC_BOILERPLATE_END
+    });
+
+    Describe("De-duplication", [this] {
+        It("should share one query between requests from the same region to the same goal", [this] {
+            // Arrange
+            AActor* Goal = SpawnGoal();
+            ADDAIController* First = SpawnController();
+            ADDAIController* Second = SpawnController();
+
+            // Act
+            PathRequests->RequestPath(First, FVector(10.0, 10.0, 0.0), *Goal, AgentProperties);
+            PathRequests->RequestPath(Second, FVector(40.0, 20.0, 0.0), *Goal, AgentProperties);
+
+            // Assert
+            TestEqual("Should queue one query", PathRequests->GetNumQueries(), 1);
+            TestEqual("Should have two waiting controllers", PathRequests->GetNumWaitingControllers(), 2);
+        });
+
+        It("should keep separate queries for different regions or goals", [this] {
+            // Arrange
+            AActor* FirstGoal = SpawnGoal();
+            AActor* SecondGoal = SpawnGoal();
+
+            // Act
+            PathRequests->RequestPath(SpawnController(), FVector(10.0, 10.0, 0.0), *FirstGoal, AgentProperties);
+            PathRequests->RequestPath(SpawnController(), FVector(5000.0, 10.0, 0.0), *FirstGoal, AgentProperties);
+            PathRequests->RequestPath(SpawnController(), FVector(10.0, 10.0, 0.0), *SecondGoal, AgentProperties);
+
+            // Assert
+            TestEqual("Should queue three queries", PathRequests->GetNumQueries(), 3);
+        });
+
+        It("should replace a controller's earlier request", [this] {
+            // Arrange
+            AActor* FirstGoal = SpawnGoal();
+            AActor* SecondGoal = SpawnGoal();
+            ADDAIController* Controller = SpawnController();
+            PathRequests->RequestPath(Controller, FVector::ZeroVector, *FirstGoal, AgentProperties);
+
+            // Act
+            PathRequests->RequestPath(Controller, FVector::ZeroVector, *SecondGoal, AgentProperties);
+
+            // Assert
+            TestEqual("Should drop the abandoned query", PathRequests->GetNumQueries(), 1);
+            TestEqual("Should have one waiting controller", PathRequests->GetNumWaitingControllers(), 1);
+        });
+    });
+
+    Describe("Cancellation", [this] {
+        It("should keep a shared query for the controllers still waiting", [this] {
+            // Arrange
+            AActor* Goal = SpawnGoal();
+            ADDAIController* First = SpawnController();
+            ADDAIController* Second = SpawnController();
+            PathRequests->RequestPath(First, FVector::ZeroVector, *Goal, AgentProperties);
+            PathRequests->RequestPath(Second, FVector::ZeroVector, *Goal, AgentProperties);
+
+            // Act
+            PathRequests->CancelRequest(First);
+
+            // Assert
+            TestFalse("Cancelled controller should not be pending", PathRequests->IsRequestPending(First));
+            TestTrue("Other controller should still be pending", PathRequests->IsRequestPending(Second));
+            TestEqual("Should keep the query", PathRequests->GetNumQueries(), 1);
+        });
+
+        It("should drop a query once nobody waits for it", [this] {
+            // Arrange
+            AActor* Goal = SpawnGoal();
+            ADDAIController* Controller = SpawnController();
+            PathRequests->RequestPath(Controller, FVector::ZeroVector, *Goal, AgentProperties);
+
+            // Act
+            PathRequests->CancelRequest(Controller);
+
+            // Assert
+            TestEqual("Should have no queries", PathRequests->GetNumQueries(), 0);
+        });
+    });
+}
+
+ADDAIController* FPathRequestManagerSpec::SpawnController() const {
+    return BaseSpec.WorldHelper->GetWorld()->SpawnActor<ADDAIController>();
+}
+
+AActor* FPathRequestManagerSpec::SpawnGoal() const {
+    return BaseSpec.WorldHelper->GetWorld()->SpawnActor<AActor>();
+}
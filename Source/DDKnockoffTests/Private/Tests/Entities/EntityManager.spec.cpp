@@ -3,6 +3,17 @@
 #include "Tests/Common/BaseSpec.h"
 #include "Entities/EntityManager.h"
 #include "Mocks/MockEnemy.h"
+#include "Mocks/MockEntity.h"
+
+namespace EntityManagerSpecFragments {
+    struct FPosition {
+        FVector Value = FVector::ZeroVector;
+    };
+
+    struct FVelocity {
+        FVector Value = FVector::ZeroVector;
+    };
+}
 
 BEGIN_DEFINE_SPEC(FEntityManagerSpec,
                   "DDKnockoff.Entities.EntityManager",
@@ -16,6 +27,14 @@ BEGIN_DEFINE_SPEC(FEntityManagerSpec,
     TObjectPtr<UEntityManager> EntityManager;
     TObjectPtr<AMockEnemy> TestEntity;
 
+    /**
+     * Spawn a mock enemy of the given faction at a location.
+     * @param Faction - Faction for the spawned enemy
+     * @param Location - World location to spawn at
+     * @return Spawned mock enemy
+     */
+    AMockEnemy* SpawnMockEnemyAt(EFaction Faction, const FVector& Location);
+
 END_DEFINE_SPEC(FEntityManagerSpec)
 
 void FEntityManagerSpec::Define() {
@@ -49,7 +68,7 @@ void FEntityManagerSpec::Define() {
              int32 InitialCount = EntityManager->GetAllEntities().Num();
 
             // Act
-            EntityManager->RegisterEntity(TestEntity);
+            EntityManager->RegisterEntity(NewObject<UMockEntity>(EntityManager));
 
             // Assert
             TestEqual("Should track registered entity", 
@@ -67,6 +86,21 @@ void FEntityManagerSpec::Define() {
             TestEqual("Should ignore null entities", 
                      EntityManager->GetAllEntities().Num(), InitialCount);
         });
+
+        It("should refuse to register an entity twice", [this] {
+            // Arrange - the test entity registered itself in BeginPlay
+            AddExpectedError(TEXT("already registered"), EAutomationExpectedErrorFlags::Contains, 1);
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+            const FEntityHandle Handle = TestEntity->GetEntityHandle();
+
+            // Act
+            const FEntityHandle SecondHandle = EntityManager->RegisterEntity(TestEntity);
+
+            // Assert
+            TestEqual("Should not track the entity twice", EntityManager->GetAllEntities().Num(), InitialCount);
+            TestTrue("Should hand back the existing handle", SecondHandle == Handle);
+            TestTrue("Existing handle should stay valid", EntityManager->IsHandleValid(Handle));
+        });
     });
 
     Describe("Entity Unregistration", [this] {
@@ -81,6 +115,73 @@ void FEntityManagerSpec::Define() {
             TestEqual("Should remove entity", EntityManager->GetAllEntities().Num(), InitialCount - 1);
         });
 
+        It("should keep bucket queries consistent after swap-removal", [this] {
+            // Arrange
+            TArray<UMockEntity*> Entities;
+            for (int32 i = 0; i < 8; ++i) {
+                UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+                Entity->SetFaction(EFaction::Enemy);
+                EntityManager->RegisterEntity(Entity);
+                Entities.Add(Entity);
+            }
+
+            // Act - remove from the front and middle so entries get swapped into the gaps
+            EntityManager->UnregisterEntity(Entities[0]);
+            EntityManager->UnregisterEntity(Entities[3]);
+            EntityManager->UnregisterEntity(Entities[7]);
+
+            // Assert
+            const TArray<TScriptInterface<IEntity>> EnemyEntities =
+                EntityManager->GetEntitiesByFactionAndType(EFaction::Enemy, EEntityType::Character);
+            TestEqual("Should have remaining enemies", EnemyEntities.Num(), 5);
+            for (const int32 Remaining : {1, 2, 4, 5, 6}) {
+                TestTrue("Remaining entity should still be queryable",
+                         EnemyEntities.Contains(TScriptInterface<IEntity>(Entities[Remaining])));
+                TestTrue("Remaining entity handle should resolve",
+                         EntityManager->IsHandleValid(Entities[Remaining]->GetEntityHandle()));
+            }
+        });
+
+        It("should keep bucket indices pointing back at their slots across removals", [this] {
+            // Arrange - spread entities over factions and types so every bucket is exercised
+            constexpr int32 EntityCount = 1000;
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+            TArray<UMockEntity*> Entities;
+            for (int32 i = 0; i < EntityCount; ++i) {
+                UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+                Entity->SetFaction(i % 2 == 0 ? EFaction::Enemy : EFaction::Player);
+                Entity->SetEntityType(i % 3 == 0
+                                          ? EEntityType::Projectile
+                                          : EEntityType::Character);
+                EntityManager->RegisterEntity(Entity);
+                Entities.Add(Entity);
+            }
+
+            // Act - remove from the front, middle and back so most removals swap an entry in,
+            // checking after every pass and re-registering some to reuse the freed slots
+            bool bConsistent = EntityManager->AreBucketIndicesConsistentForTesting();
+            for (const int32 Stride : {7, 3, 2}) {
+                for (int32 i = 0; i < Entities.Num(); i += Stride) {
+                    EntityManager->UnregisterEntity(Entities[i]);
+                }
+                bConsistent = EntityManager->AreBucketIndicesConsistentForTesting() && bConsistent;
+
+                for (int32 i = 0; i < Entities.Num(); i += Stride * 2) {
+                    EntityManager->RegisterEntity(Entities[i]);
+                }
+                bConsistent = EntityManager->AreBucketIndicesConsistentForTesting() && bConsistent;
+            }
+            for (UMockEntity* Entity : Entities) { EntityManager->UnregisterEntity(Entity); }
+
+            // Assert
+            TestTrue("Every stored bucket index should point back at its slot", bConsistent);
+            TestTrue("Indices should stay consistent once emptied",
+                     EntityManager->AreBucketIndicesConsistentForTesting());
+            TestEqual("All mock entities should be removed",
+                      EntityManager->GetAllEntities().Num(),
+                      InitialCount);
+        });
+
         It("should handle unregistering null entities", [this] {
             // Arrange
              int32 InitialCount = EntityManager->GetAllEntities().Num();
@@ -93,6 +194,196 @@ void FEntityManagerSpec::Define() {
         });
     });
 
+    Describe("Deferred Registration", [this] {
+        It("should only apply queued registrations on commit", [this] {
+            // Arrange
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+
+            // Act
+            EntityManager->QueueRegister(Entity);
+            const int32 CountBeforeCommit = EntityManager->GetAllEntities().Num();
+            EntityManager->CommitPendingOperations();
+
+            // Assert
+            TestEqual("Should not register before commit", CountBeforeCommit, InitialCount);
+            TestEqual("Should register on commit", EntityManager->GetAllEntities().Num(), InitialCount + 1);
+            TestTrue("Should issue a handle on commit", EntityManager->IsHandleValid(Entity->GetEntityHandle()));
+        });
+
+        It("should only apply queued unregistrations on commit", [this] {
+            // Arrange
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+
+            // Act
+            EntityManager->QueueUnregister(TestEntity);
+            const int32 CountBeforeCommit = EntityManager->GetAllEntities().Num();
+            EntityManager->CommitPendingOperations();
+
+            // Assert
+            TestEqual("Should not unregister before commit", CountBeforeCommit, InitialCount);
+            TestEqual("Should unregister on commit", EntityManager->GetAllEntities().Num(), InitialCount - 1);
+        });
+
+        It("should cancel a pending registration when unregistered in the same frame", [this] {
+            // Arrange
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+
+            // Act
+            EntityManager->QueueRegister(Entity);
+            EntityManager->QueueUnregister(Entity);
+
+            // Assert
+            TestFalse("Should have nothing left to commit", EntityManager->HasPendingOperations());
+            EntityManager->CommitPendingOperations();
+            TestEqual("Should not register the entity", EntityManager->GetAllEntities().Num(), InitialCount);
+        });
+
+        It("should commit queued operations on tick", [this] {
+            // Arrange
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            const int32 InitialCount = EntityManager->GetAllEntities().Num();
+
+            // Act
+            EntityManager->QueueRegister(Entity);
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestEqual("Should register on tick", EntityManager->GetAllEntities().Num(), InitialCount + 1);
+        });
+
+        It("should release a queued unregistration whose entity was garbage collected", [this] {
+            // Arrange
+            const int32 InitialCount = EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character);
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            const FEntityHandle Handle = EntityManager->RegisterEntity(Entity);
+            EntityManager->QueueUnregister(Entity);
+
+            // Act - collected between the queueing and the commit, as after a destroyed actor's EndPlay
+            Entity->MarkAsGarbage();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            EntityManager->CommitPendingOperations();
+
+            // Assert
+            TestEqual("Should drop the entity from its bucket",
+                      EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character), InitialCount);
+            TestEqual("Should drop the entity from the live statistics",
+                      EntityManager->GetStats().GetFactionAndTypeCount(EFaction::Enemy, EEntityType::Character).Live,
+                      InitialCount);
+            TestFalse("Should invalidate the handle", EntityManager->IsHandleValid(Handle));
+        });
+
+        It("should release entities garbage collected without unregistering", [this] {
+            // Arrange
+            const int32 InitialCount = EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character);
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            EntityManager->RegisterEntity(Entity);
+
+            // Act
+            Entity->MarkAsGarbage();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            EntityManager->CommitPendingOperations();
+
+            // Assert
+            TestEqual("Should drop the entity from its bucket",
+                      EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character), InitialCount);
+        });
+    });
+
+    Describe("Change Journal", [this] {
+        It("should only deliver records matching the subscription filter", [this] {
+            // Arrange
+            EntityManager->DispatchChangeJournal();
+            const TSharedRef<TArray<FEntityChangeRecord>> Received = MakeShared<TArray<FEntityChangeRecord>>();
+            FEntityChangeFilter Filter;
+            Filter.ChangeTypes = EEntityChangeType::Added;
+            Filter.Faction = EFaction::Enemy;
+            EntityManager->SubscribeToChanges(Filter, FOnEntityChangesDelegate::CreateLambda(
+                [Received](TConstArrayView<FEntityChangeRecord> Changes) { Received->Append(Changes); }));
+
+            UMockEntity* Enemy = NewObject<UMockEntity>(EntityManager);
+            UMockEntity* Ally = NewObject<UMockEntity>(EntityManager);
+            Ally->SetFaction(EFaction::Player);
+
+            // Act
+            EntityManager->RegisterEntity(Enemy);
+            EntityManager->RegisterEntity(Ally);
+            const int32 ReceivedBeforeDispatch = Received->Num();
+            EntityManager->DispatchChangeJournal();
+
+            // Assert
+            TestEqual("Should batch records until dispatch", ReceivedBeforeDispatch, 0);
+            TestEqual("Should only deliver the matching record", Received->Num(), 1);
+            TestEqual("Should carry the entity handle", (*Received)[0].Handle, Enemy->GetEntityHandle());
+            TestEqual("Should be an added record", (*Received)[0].ChangeType, EEntityChangeType::Added);
+        });
+
+        It("should record removals and targetability changes", [this] {
+            // Arrange
+            EntityManager->DispatchChangeJournal();
+            const TSharedRef<TArray<FEntityChangeRecord>> Received = MakeShared<TArray<FEntityChangeRecord>>();
+            EntityManager->SubscribeToChanges(FEntityChangeFilter(), FOnEntityChangesDelegate::CreateLambda(
+                [Received](TConstArrayView<FEntityChangeRecord> Changes) { Received->Append(Changes); }));
+            const FEntityHandle Handle = TestEntity->GetEntityHandle();
+
+            // Act
+            EntityManager->SetEntityTargetable(Handle, false);
+            EntityManager->SetEntityTargetable(Handle, false);
+            EntityManager->UnregisterEntity(TestEntity);
+            EntityManager->DispatchChangeJournal();
+
+            // Assert
+            TestEqual("Should skip unchanged targetability", Received->Num(), 2);
+            TestEqual("Should record the targetability change first",
+                      (*Received)[0].ChangeType, EEntityChangeType::TargetabilityChanged);
+            TestFalse("Should carry the new targetability", (*Received)[0].bTargetable);
+            TestEqual("Should record the removal", (*Received)[1].ChangeType, EEntityChangeType::Removed);
+            TestEqual("Removal should keep the released handle", (*Received)[1].Handle, Handle);
+        });
+
+        It("should move buckets and notify subscribers of either bucket", [this] {
+            // Arrange
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            EntityManager->RegisterEntity(Entity);
+            EntityManager->DispatchChangeJournal();
+            const TSharedRef<TArray<FEntityChangeRecord>> Received = MakeShared<TArray<FEntityChangeRecord>>();
+            FEntityChangeFilter Filter;
+            Filter.Faction = EFaction::Enemy;
+            EntityManager->SubscribeToChanges(Filter, FOnEntityChangesDelegate::CreateLambda(
+                [Received](TConstArrayView<FEntityChangeRecord> Changes) { Received->Append(Changes); }));
+
+            // Act
+            Entity->SetFaction(EFaction::Player);
+            EntityManager->RefreshEntityBuckets(Entity->GetEntityHandle());
+            EntityManager->DispatchChangeJournal();
+
+            // Assert
+            TestEqual("Should leave the old bucket", EntityManager->CountByFaction(EFaction::Enemy), 0);
+            TestEqual("Should join the new bucket", EntityManager->CountByFaction(EFaction::Player), 2);
+            TestEqual("Should notify the old bucket's subscriber", Received->Num(), 1);
+            TestEqual("Should be a moved record", (*Received)[0].ChangeType, EEntityChangeType::MovedBucket);
+            TestEqual("Should carry the previous faction", (*Received)[0].PreviousFaction, EFaction::Enemy);
+        });
+
+        It("should stop delivering after unsubscribing", [this] {
+            // Arrange
+            int32 CallCount = 0;
+            const FDelegateHandle Handle = EntityManager->SubscribeToChanges(
+                FEntityChangeFilter(),
+                FOnEntityChangesDelegate::CreateLambda(
+                    [&CallCount](TConstArrayView<FEntityChangeRecord> Changes) { ++CallCount; }));
+
+            // Act
+            EntityManager->UnsubscribeFromChanges(Handle);
+            EntityManager->RegisterEntity(NewObject<UMockEntity>(EntityManager));
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestEqual("Should not call an unsubscribed delegate", CallCount, 0);
+        });
+    });
+
     Describe("Entity Queries", [this] {
         It("should find entities by faction", [this] {
             // Act
@@ -105,6 +396,27 @@ void FEntityManagerSpec::Define() {
             TestEqual("Found entity should be test entity", PlayerEntities[0]->GetActor(), static_cast<AActor*>(TestEntity));
         });
 
+        It("should view entities by faction without copying", [this] {
+            // Act
+            const FEntityView PlayerEntities = EntityManager->ViewEntitiesByFaction(EFaction::Player);
+            const FEntityView EnemyEntities = EntityManager->ViewEntitiesByFaction(EFaction::Enemy);
+
+            // Assert
+            TestEqual("Should view player entity", PlayerEntities.Num(), 1);
+            TestTrue("Should not view enemy entities", EnemyEntities.IsEmpty());
+            TestEqual("Viewed entity should be test entity", PlayerEntities[0]->GetActor(), static_cast<AActor*>(TestEntity));
+        });
+
+        It("should count entities by faction and type", [this] {
+            // Assert
+            TestEqual("Should count player characters",
+                      EntityManager->CountByFactionAndType(EFaction::Player, EEntityType::Character), 1);
+            TestEqual("Should count player faction", EntityManager->CountByFaction(EFaction::Player), 1);
+            TestEqual("Should count character type", EntityManager->CountByType(EEntityType::Character), 1);
+            TestEqual("Should not count enemy characters",
+                      EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character), 0);
+        });
+
         It("should find entities by ID", [this] {
             // Arrange
              FGuid EntityID = TestEntity->GetEntityData()->GetID();
@@ -117,4 +429,503 @@ void FEntityManagerSpec::Define() {
             TestEqual("Found entity should be test entity", FoundEntity->GetActor(), static_cast<AActor*>(TestEntity));
         });
     });
+
+    Describe("Spatial Queries", [this] {
+        It("should find entities within a radius", [this] {
+            // Arrange
+            AMockEnemy* NearEnemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(300.0f, 0.0f, 0.0f));
+            SpawnMockEnemyAt(EFaction::Enemy, FVector(2000.0f, 0.0f, 0.0f));
+
+            // Act
+            TArray<FEntityHandle> Handles;
+            EntityManager->QueryRadius(EFaction::Enemy, EEntityType::None, FVector::ZeroVector, 500.0f, Handles);
+
+            // Assert
+            TestEqual("Should find only the near enemy", Handles.Num(), 1);
+            TestEqual("Found entity should be near enemy",
+                      EntityManager->ResolveActor(Handles[0]), static_cast<AActor*>(NearEnemy));
+        });
+
+        It("should find the nearest entities in order", [this] {
+            // Arrange
+            AMockEnemy* FarEnemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(-1800.0f, 900.0f, 0.0f));
+            AMockEnemy* MiddleEnemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(0.0f, 1200.0f, 0.0f));
+            AMockEnemy* CloseEnemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(700.0f, 0.0f, 0.0f));
+
+            // Act
+            TArray<FEntityHandle> Handles;
+            EntityManager->FindNearest(EFaction::Enemy, EEntityType::Character, FVector::ZeroVector, 2, Handles);
+
+            // Assert
+            TestEqual("Should return the requested count", Handles.Num(), 2);
+            TestEqual("Nearest should be first", EntityManager->ResolveActor(Handles[0]), static_cast<AActor*>(CloseEnemy));
+            TestEqual("Second nearest should be second", EntityManager->ResolveActor(Handles[1]), static_cast<AActor*>(MiddleEnemy));
+            TestFalse("Furthest should be excluded", Handles.Contains(FarEnemy->GetEntityHandle()));
+        });
+
+        It("should track entities as they move", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(3000.0f, 0.0f, 0.0f));
+
+            // Act
+            Enemy->SetActorLocation(FVector(100.0f, 0.0f, 0.0f));
+            TArray<FEntityHandle> Handles;
+            EntityManager->QueryRadius(EFaction::Enemy, EEntityType::None, FVector::ZeroVector, 500.0f, Handles);
+
+            // Assert
+            TestEqual("Should find the moved enemy", Handles.Num(), 1);
+        });
+
+        It("should stop returning entities once unregistered", [this] {
+            // Act
+            EntityManager->UnregisterEntity(TestEntity);
+            TArray<FEntityHandle> Handles;
+            EntityManager->QueryRadius(EFaction::None, EEntityType::None, FVector::ZeroVector, 500.0f, Handles);
+
+            // Assert
+            TestEqual("Should not find unregistered entity", Handles.Num(), 0);
+        });
+
+        It("should answer queries with an unbounded radius", [this] {
+            // Arrange
+            SpawnMockEnemyAt(EFaction::Enemy, FVector(300.0f, 0.0f, 0.0f));
+            SpawnMockEnemyAt(EFaction::Enemy, FVector(-90000.0f, 50000.0f, 0.0f));
+
+            // Act
+            TArray<FEntityHandle> Handles;
+            EntityManager->QueryRadius(EFaction::Enemy, EEntityType::None, FVector::ZeroVector, FLT_MAX, Handles);
+
+            // Assert
+            TestEqual("Should find both enemies", Handles.Num(), 2);
+        });
+
+        It("should keep finding entities after the occupied area shrinks", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(90000.0f, 0.0f, 0.0f));
+            Enemy->SetActorLocation(FVector(100.0f, 0.0f, 0.0f));
+
+            // Act
+            TArray<FEntityHandle> Handles;
+            EntityManager->FindNearest(EFaction::Enemy, EEntityType::Character, FVector(-90000.0f, 0.0f, 0.0f), 1, Handles);
+
+            // Assert
+            TestEqual("Should find the moved enemy", Handles.Num(), 1);
+        });
+
+        It("should keep finding entities once the bounds shrink on tick", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(90000.0f, 0.0f, 0.0f));
+            Enemy->SetActorLocation(FVector(100.0f, 0.0f, 0.0f));
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Act
+            TArray<FEntityHandle> NearestHandles;
+            EntityManager->FindNearest(EFaction::Enemy,
+                                       EEntityType::Character,
+                                       FVector(-90000.0f, 0.0f, 0.0f),
+                                       1,
+                                       NearestHandles);
+            TArray<FEntityHandle> RadiusHandles;
+            EntityManager->QueryRadius(EFaction::Enemy,
+                                       EEntityType::None,
+                                       FVector::ZeroVector,
+                                       500.0f,
+                                       RadiusHandles);
+
+            // Assert
+            TestEqual("Nearest search should find the moved enemy", NearestHandles.Num(), 1);
+            TestEqual("Radius query should find the moved enemy", RadiusHandles.Num(), 1);
+        });
+    });
+
+    Describe("Statistics", [this] {
+        It("should track live counts, high-water marks and totals", [this] {
+            // Arrange
+            const FEntityManagerStats InitialStats = EntityManager->GetStats();
+            UMockEntity* First = NewObject<UMockEntity>(EntityManager);
+            UMockEntity* Second = NewObject<UMockEntity>(EntityManager);
+
+            // Act
+            EntityManager->RegisterEntity(First);
+            EntityManager->RegisterEntity(Second);
+            EntityManager->UnregisterEntity(First);
+            const FEntityManagerStats& Stats = EntityManager->GetStats();
+
+            // Assert
+            const FEntityBucketCount EnemyCharacters = Stats.GetFactionAndTypeCount(EFaction::Enemy, EEntityType::Character);
+            TestEqual("Should count live entities", Stats.All.Live, InitialStats.All.Live + 1);
+            TestEqual("Should keep the peak", Stats.All.HighWater, InitialStats.All.Live + 2);
+            TestEqual("Should count live enemy characters", EnemyCharacters.Live, 1);
+            TestEqual("Should keep the enemy character peak", EnemyCharacters.HighWater, 2);
+            TestEqual("Should total registrations", Stats.TotalRegistered, InitialStats.TotalRegistered + 2);
+            TestEqual("Should total unregistrations", Stats.TotalUnregistered, InitialStats.TotalUnregistered + 1);
+        });
+
+        It("should agree with bucket counts after a bucket move", [this] {
+            // Arrange
+            UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+            EntityManager->RegisterEntity(Entity);
+
+            // Act
+            Entity->SetEntityType(EEntityType::Structure_Crystal);
+            EntityManager->RefreshEntityBuckets(Entity->GetEntityHandle());
+            const FEntityManagerStats& Stats = EntityManager->GetStats();
+
+            // Assert
+            TestEqual("Should leave the old type", Stats.GetTypeCount(EEntityType::Character).Live,
+                      EntityManager->CountByType(EEntityType::Character));
+            TestEqual("Should join the new type", Stats.GetTypeCount(EEntityType::Structure_Crystal).Live,
+                      EntityManager->CountByType(EEntityType::Structure_Crystal));
+        });
+    });
+
+    Describe("Hot Data", [this] {
+        It("should mirror registered entity fields", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(250.0f, 0.0f, 0.0f));
+
+            // Act
+            const int32 HotIndex = EntityManager->GetHotIndex(Enemy->GetEntityHandle());
+            const FEntityHotData& HotData = EntityManager->GetHotData();
+
+            // Assert
+            TestNotEqual("Should have a hot index", HotIndex, INDEX_NONE);
+            TestEqual("Should stay packed with all entities", HotData.Num(), EntityManager->GetAllEntities().Num());
+            TestEqual("Should mirror faction", HotData.Factions[HotIndex], EFaction::Enemy);
+            TestEqual("Should mirror position", HotData.Positions[HotIndex], FVector(250.0f, 0.0f, 0.0f));
+            TestEqual("Should mirror health", HotData.Health[HotIndex], Enemy->GetCurrentHealth());
+        });
+
+        It("should stay aligned after swap-removal", [this] {
+            // Arrange
+            AMockEnemy* First = SpawnMockEnemyAt(EFaction::Enemy, FVector(100.0f, 0.0f, 0.0f));
+            AMockEnemy* Last = SpawnMockEnemyAt(EFaction::Enemy, FVector(900.0f, 0.0f, 0.0f));
+
+            // Act
+            EntityManager->UnregisterEntity(First);
+            const int32 HotIndex = EntityManager->GetHotIndex(Last->GetEntityHandle());
+
+            // Assert
+            TestEqual("Moved entry should keep its handle",
+                      EntityManager->GetHotData().Handles[HotIndex], Last->GetEntityHandle());
+            TestEqual("Moved entry should keep its position",
+                      EntityManager->GetHotData().Positions[HotIndex], FVector(900.0f, 0.0f, 0.0f));
+        });
+
+        It("should apply pushed health and targetability", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(100.0f, 0.0f, 0.0f));
+            FEntityQueryFilter Filter;
+            Filter.Faction = EFaction::Enemy;
+            Filter.bTargetableOnly = true;
+
+            // Act
+            Enemy->SetHealth(40.0f);
+            EntityManager->SetEntityTargetable(Enemy->GetEntityHandle(), false);
+            TArray<FEntityHandle> Handles;
+            EntityManager->QueryRadius(Filter, FVector::ZeroVector, 500.0f, Handles);
+
+            // Assert
+            const int32 HotIndex = EntityManager->GetHotIndex(Enemy->GetEntityHandle());
+            TestEqual("Should reflect pushed health", EntityManager->GetHotData().Health[HotIndex], 40.0f);
+            TestEqual("Should skip untargetable entities", Handles.Num(), 0);
+        });
+    });
+
+    Describe("Archetypes", [this] {
+        using namespace EntityManagerSpecFragments;
+
+        It("should keep chunks dense and row handles stable across removals", [this] {
+            // Arrange
+            auto& Archetype = EntityManager->CreateArchetype<FPosition, FVelocity>(
+                TEXT("TestProjectiles"), EFaction::Player, EEntityType::None);
+            TArray<FArchetypeRowHandle> Rows;
+            for (int32 Index = 0; Index < Archetype.ChunkCapacity + 2; ++Index) {
+                Rows.Add(Archetype.AddRow(FPosition{FVector(static_cast<double>(Index), 0.0, 0.0)}, FVelocity()));
+            }
+            const int32 ChunksBeforeRemoval = Archetype.NumChunks();
+
+            // Act
+            Archetype.RemoveRow(Rows[0]);
+            Archetype.RemoveRow(Rows[1]);
+
+            // Assert
+            TestEqual("Should span two chunks before removal", ChunksBeforeRemoval, 2);
+            TestEqual("Should release the emptied chunk", Archetype.NumChunks(), 1);
+            TestEqual("Should count remaining rows", Archetype.Num(), Archetype.ChunkCapacity);
+            TestFalse("Removed row should be stale", Archetype.IsRowValid(Rows[0]));
+            const FArchetypeRowHandle MovedRow = Rows.Last();
+            TestEqual("Moved row should keep its fragments",
+                      Archetype.GetFragment<FPosition>(MovedRow)->Value.X,
+                      static_cast<double>(Archetype.ChunkCapacity + 1));
+        });
+
+        It("should run registered systems on tick", [this] {
+            // Arrange
+            auto& Archetype = EntityManager->CreateArchetype<FPosition, FVelocity>(
+                TEXT("TestPickups"), EFaction::None, EEntityType::None);
+            const FArchetypeRowHandle Row = Archetype.AddRow(FPosition(), FVelocity{FVector(100.0f, 0.0f, 0.0f)});
+            EntityManager->RegisterArchetypeSystem(TEXT("Integrate"), [&Archetype](const float DeltaTime) {
+                Archetype.ForEachChunk([DeltaTime](TConstArrayView<FArchetypeRowHandle> Rows,
+                                                   TArrayView<FPosition> Positions,
+                                                   TArrayView<FVelocity> Velocities) {
+                    for (int32 Index = 0; Index < Rows.Num(); ++Index) {
+                        Positions[Index].Value += Velocities[Index].Value * DeltaTime;
+                    }
+                });
+            });
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestTrue("System should move the row", Archetype.GetFragment<FPosition>(Row)->Value.X > 0.0);
+        });
+
+        It("should defer systems registered or unregistered by a running system", [this] {
+            // Arrange - the first system swaps itself out for a counting system
+            const TSharedRef<int32> SetupRuns = MakeShared<int32>(0);
+            const TSharedRef<int32> CounterRuns = MakeShared<int32>(0);
+            UEntityManager* Manager = EntityManager;
+            EntityManager->RegisterArchetypeSystem(TEXT("Setup"), [Manager, SetupRuns, CounterRuns](float) {
+                ++*SetupRuns;
+                Manager->RegisterArchetypeSystem(TEXT("Counter"), [CounterRuns](float) { ++*CounterRuns; });
+                Manager->UnregisterArchetypeSystem(TEXT("Setup"));
+            });
+
+            // Act
+            EntityManager->Tick(0.0f);
+            const int32 CounterRunsAfterFirstTick = *CounterRuns;
+            EntityManager->Tick(0.0f);
+
+            // Assert
+            TestEqual("Setup should run once", *SetupRuns, 1);
+            TestEqual("Counter should wait for the next frame", CounterRunsAfterFirstTick, 0);
+            TestEqual("Counter should run on the next frame", *CounterRuns, 1);
+        });
+
+        It("should replace a row with a proxy entity on materialization", [this] {
+            // Arrange
+            auto& Archetype = EntityManager->CreateArchetype<FPosition>(
+                TEXT("TestEnemies"), EFaction::Enemy, EEntityType::Character);
+            const FArchetypeRowHandle Row = Archetype.AddRow(FPosition());
+            UEntityManager* Manager = EntityManager;
+            Archetype.SetProxyFactory([Manager](UWorld&, FEntityArchetypeBase&, const FArchetypeRowHandle&) -> IEntity* {
+                UMockEntity* Proxy = NewObject<UMockEntity>(Manager);
+                Manager->RegisterEntity(Proxy);
+                return Proxy;
+            });
+            const int32 RowsBefore = EntityManager->CountArchetypeRows(EFaction::Enemy, EEntityType::Character);
+
+            // Act
+            IEntity* Proxy = EntityManager->MaterializeProxy(TEXT("TestEnemies"), Row);
+
+            // Assert
+            TestEqual("Should count the row before materializing", RowsBefore, 1);
+            TestNotNull("Should return the proxy", Proxy);
+            TestFalse("Should remove the row", Archetype.IsRowValid(Row));
+            TestEqual("Proxy should be registered",
+                      EntityManager->CountByFactionAndType(EFaction::Enemy, EEntityType::Character), 1);
+        });
+    });
+
+    Describe("Registry Snapshots", [this] {
+        It("should publish registrations on the next tick", [this] {
+            // Arrange
+            AMockEnemy* Enemy = SpawnMockEnemyAt(EFaction::Enemy, FVector(300.0f, 0.0f, 0.0f));
+            FEntityQueryFilter Filter;
+            Filter.Faction = EFaction::Enemy;
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+            const FEntityRegistrySnapshotPtr Snapshot = EntityManager->GetSnapshot();
+
+            // Assert
+            TestTrue("Snapshot should be published", Snapshot.IsValid());
+            TestEqual("Snapshot should match the live registry", Snapshot->Num(), EntityManager->GetAllEntities().Num());
+            TestEqual("Snapshot should find the nearest enemy",
+                      Snapshot->FindNearest(Filter, FVector::ZeroVector), Enemy->GetEntityHandle());
+        });
+
+        It("should leave a held snapshot untouched by later frames", [this] {
+            // Arrange
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+            const FEntityRegistrySnapshotPtr HeldSnapshot = EntityManager->GetSnapshot();
+            const int32 HeldCount = HeldSnapshot->Num();
+            const uint64 HeldFrame = HeldSnapshot->FrameNumber;
+
+            // Act
+            SpawnMockEnemyAt(EFaction::Enemy, FVector(100.0f, 0.0f, 0.0f));
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 3);
+
+            // Assert
+            TestEqual("Held snapshot should keep its entity count", HeldSnapshot->Num(), HeldCount);
+            TestEqual("Held snapshot should keep its frame number", HeldSnapshot->FrameNumber, HeldFrame);
+            TestEqual("Latest snapshot should include the new entity",
+                      EntityManager->GetSnapshot()->Num(), HeldCount + 1);
+            TestTrue("Latest snapshot should be newer",
+                     EntityManager->GetSnapshot()->FrameNumber > HeldFrame);
+        });
+
+        It("should publish only when a snapshot is asked for, once per frame", [this] {
+            // Arrange
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+            const uint64 PreviousFrame = EntityManager->GetSnapshot()->FrameNumber;
+
+            // Act
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 3);
+            const FEntityRegistrySnapshotPtr First = EntityManager->GetSnapshot();
+            const FEntityRegistrySnapshotPtr Second = EntityManager->GetSnapshot();
+
+            // Assert
+            TestEqual("Frames nobody read should not publish",
+                      First->FrameNumber,
+                      PreviousFrame + 1);
+            TestTrue("Reads within a frame should share one snapshot", First == Second);
+        });
+    });
+
+    Describe("Entity Handles", [this] {
+        It("should resolve a registered entity's handle", [this] {
+            // Arrange
+            const FEntityHandle Handle = TestEntity->GetEntityHandle();
+
+            // Act
+            AActor* ResolvedActor = EntityManager->ResolveActor(Handle);
+
+            // Assert
+            TestTrue("Handle should be valid", EntityManager->IsHandleValid(Handle));
+            TestEqual("Handle should resolve to test entity", ResolvedActor, static_cast<AActor*>(TestEntity));
+        });
+
+        It("should invalidate handles when an entity is unregistered", [this] {
+            // Arrange
+            const FEntityHandle Handle = TestEntity->GetEntityHandle();
+
+            // Act
+            EntityManager->UnregisterEntity(TestEntity);
+
+            // Assert
+            TestFalse("Stale handle should be invalid", EntityManager->IsHandleValid(Handle));
+            TestNull("Stale handle should not resolve", EntityManager->ResolveActor(Handle));
+        });
+
+        It("should not resolve stale handles to a reused slot", [this] {
+            // Arrange
+            const FEntityHandle OldHandle = TestEntity->GetEntityHandle();
+            EntityManager->UnregisterEntity(TestEntity);
+
+            // Act
+            const FEntityHandle NewHandle = EntityManager->RegisterEntity(TestEntity);
+
+            // Assert
+            TestEqual("Slot should be reused", NewHandle.GetIndex(), OldHandle.GetIndex());
+            TestNotEqual("Generation should differ", NewHandle.GetGeneration(), OldHandle.GetGeneration());
+            TestFalse("Old handle should be invalid", EntityManager->IsHandleValid(OldHandle));
+            TestTrue("New handle should be valid", EntityManager->IsHandleValid(NewHandle));
+        });
+    });
+
+    Describe("Soft Reset", [this] {
+        using namespace EntityManagerSpecFragments;
+
+        It("should keep surviving entities and restart statistics", [this] {
+            // Arrange
+            UMockEntity* Destroyed = NewObject<UMockEntity>(EntityManager);
+            UMockEntity* Survivor = NewObject<UMockEntity>(EntityManager);
+            UMockEntity* Queued = NewObject<UMockEntity>(EntityManager);
+            EntityManager->RegisterEntity(Destroyed);
+            EntityManager->RegisterEntity(Survivor);
+            EntityManager->UnregisterEntity(Destroyed);
+            EntityManager->QueueRegister(Queued);
+
+            // Act
+            BaseSpec.WorldHelper->GetWorld()->GetSubsystem<UManagerHandlerSubsystem>()->RefreshManagers();
+
+            // Assert
+            const FEntityManagerStats& Stats = EntityManager->GetStats();
+            TestTrue("Survivor should stay registered", EntityManager->IsHandleValid(Survivor->GetEntityHandle()));
+            TestTrue("Spawned entity should stay registered", EntityManager->IsHandleValid(TestEntity->GetEntityHandle()));
+            TestTrue("Queued registration should be applied", EntityManager->IsHandleValid(Queued->GetEntityHandle()));
+            TestFalse("Should have no pending operations", EntityManager->HasPendingOperations());
+            TestEqual("Should count the surviving entities", Stats.All.Live, 3);
+            TestEqual("Should restart the peak from the survivors", Stats.All.HighWater, 3);
+            TestEqual("Should count survivors in their buckets",
+                      Stats.GetFactionAndTypeCount(EFaction::Enemy, EEntityType::Character).Live, 2);
+            TestEqual("Should restart total registrations", Stats.TotalRegistered, 0);
+            TestEqual("Should restart total unregistrations", Stats.TotalUnregistered, 0);
+        });
+
+        It("should deliver pending records and replay survivors to subscribers", [this] {
+            // Arrange
+            EntityManager->DispatchChangeJournal();
+            const TSharedRef<TArray<FEntityChangeRecord>> Received = MakeShared<TArray<FEntityChangeRecord>>();
+            EntityManager->SubscribeToChanges(FEntityChangeFilter(), FOnEntityChangesDelegate::CreateLambda(
+                [Received](TConstArrayView<FEntityChangeRecord> Changes) { Received->Append(Changes); }));
+            UMockEntity* Destroyed = NewObject<UMockEntity>(EntityManager);
+            EntityManager->RegisterEntity(Destroyed);
+            EntityManager->UnregisterEntity(Destroyed);
+
+            // Act
+            BaseSpec.WorldHelper->GetWorld()->GetSubsystem<UManagerHandlerSubsystem>()->RefreshManagers();
+            const int32 ReceivedBeforeRefreshDispatch = Received->Num();
+            EntityManager->DispatchChangeJournal();
+
+            // Assert
+            TestEqual("Should flush the records from before the refresh", ReceivedBeforeRefreshDispatch, 2);
+            TestEqual("Should keep the subscription and replay the survivor", Received->Num(), 3);
+            TestEqual("Should replay as an added record", Received->Last().ChangeType, EEntityChangeType::Added);
+            TestEqual("Should replay the surviving entity", Received->Last().Handle, TestEntity->GetEntityHandle());
+        });
+
+        It("should keep archetypes and systems but drop their rows", [this] {
+            // Arrange
+            auto& Archetype = EntityManager->CreateArchetype<FPosition>(
+                TEXT("TestDebris"), EFaction::None, EEntityType::None);
+            Archetype.AddRow(FPosition());
+            int32 SystemRuns = 0;
+            EntityManager->RegisterArchetypeSystem(TEXT("Count"), [&SystemRuns](const float) { ++SystemRuns; });
+
+            // Act
+            BaseSpec.WorldHelper->GetWorld()->GetSubsystem<UManagerHandlerSubsystem>()->RefreshManagers();
+            FTestUtils::TickMultipleFrames(BaseSpec.WorldHelper.Get(), 1);
+
+            // Assert
+            TestTrue("Should keep the archetype", EntityManager->FindArchetype(TEXT("TestDebris")) == &Archetype);
+            TestEqual("Should drop the rows", Archetype.Num(), 0);
+            TestTrue("Should keep running the system", SystemRuns > 0);
+        });
+    });
+
+    Describe("Profiling", [this] {
+        It("should report allocated memory that grows with the registry", [this] {
+            // Arrange
+            const SIZE_T SizeBefore = EntityManager->GetAllocatedSize();
+
+            // Act
+            for (int32 i = 0; i < 256; ++i) {
+                UMockEntity* Entity = NewObject<UMockEntity>(EntityManager);
+                Entity->SetFaction(EFaction::Enemy);
+                EntityManager->RegisterEntity(Entity);
+            }
+
+            // Assert
+            TestTrue("Allocated size should grow", EntityManager->GetAllocatedSize() > SizeBefore);
+        });
+
+        It("should name its trace scope after its class", [this] {
+            // Assert
+            TestEqual("Trace name should be the class name",
+                      FString(EntityManager->GetTraceName()),
+                      UEntityManager::StaticClass()->GetName());
+        });
+    });
+}
+
+AMockEnemy* FEntityManagerSpec::SpawnMockEnemyAt(const EFaction Faction, const FVector& Location) {
+    const FTransform SpawnTransform(FRotator::ZeroRotator, Location);
+    AMockEnemy* Enemy = BaseSpec.WorldHelper->GetWorld()->SpawnActorDeferred<AMockEnemy>(AMockEnemy::StaticClass(), SpawnTransform);
+    Enemy->SetFaction(Faction);
+    Enemy->FinishSpawning(SpawnTransform);
+    return Enemy;
 }
\ No newline at end of file
@@ -62,6 +62,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Test Configuration")
     EFaction TestFaction = EFaction::Enemy;
 
+    // Test configuration for entity type override, set before BeginPlay registers the entity
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Test Configuration")
+    EEntityType TestEntityType = EEntityType::Character;
+
 public:
     // IEntity interface implementation
     virtual void TakeDamage(const FDamagePayload& DamagePayload) override;
@@ -73,7 +77,7 @@ public:
     virtual float GetHalfHeight() const override;
     virtual float GetRadius() const;
     virtual UEntityData* GetEntityData() const override { return EntityData; }
-    virtual EEntityType GetEntityType() const override { return EEntityType::Character; }
+    virtual EEntityType GetEntityType() const override { return TestEntityType; }
     virtual bool IsCurrentlyTargetable() const override { return true; }
     // End IEntity interface
 
@@ -91,6 +95,7 @@ public:
     float GetCurrentHealth() const;
     bool IsDead() const;
     void SetFaction(EFaction InFaction);
+    void SetEntityType(const EEntityType InEntityType) { TestEntityType = InEntityType; }
 
     // Test configuration
     UPROPERTY(EditAnywhere,
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Entities/Entity.h"
+#include "MockEntity.generated.h"
+
+class UEntityData;
+
+/**
+ * Lightweight non-actor entity for exercising the entity manager at scale.
+ * Does not register itself - tests drive registration directly.
+ */
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockEntity : public UObject, public IEntity {
+    GENERATED_BODY()
+
+public:
+    UMockEntity();
+
+    // IEntity interface implementation
+    virtual EFaction GetFaction() const override { return Faction; }
+    virtual AActor* GetActor() override { return nullptr; }
+    virtual UEntityData* GetEntityData() const override { return EntityData; }
+    virtual EEntityType GetEntityType() const override { return EntityType; }
+    // End IEntity interface
+
+    // Test helpers
+    void SetFaction(const EFaction InFaction) { Faction = InFaction; }
+    void SetEntityType(const EEntityType InEntityType) { EntityType = InEntityType; }
+
+protected:
+    UPROPERTY(Transient, Instanced)
+    TObjectPtr<UEntityData> EntityData;
+
+    UPROPERTY(Transient)
+    EFaction Faction = EFaction::Enemy;
+
+    UPROPERTY(Transient)
+    EEntityType EntityType = EEntityType::Character;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/ManagerBase.h"
+#include "MockManagers.generated.h"
+
+/**
+ * Manager that records the order managers are initialized and ticked in.
+ * Subclasses declare fixed dependencies to exercise the manager dependency graph.
+ */
+UCLASS(Abstract)
+class DDKNOCKOFFTESTS_API UMockOrderedManager : public UManagerBase {
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize() override;
+    virtual void Tick(float DeltaTime) override;
+
+    /** Class names in initialization order, shared by every mock manager */
+    static TArray<FName> GetInitializationLog();
+    static void ResetInitializationLog();
+
+    /** Class names in tick order, shared by every mock manager */
+    static TArray<FName> GetTickLog();
+    static void ResetTickLog();
+
+private:
+    static FCriticalSection LogLock;
+    static TArray<FName> InitializationLog;
+    static TArray<FName> TickLog;
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockRootManager : public UMockOrderedManager {
+    GENERATED_BODY()
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockMiddleManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockLeafManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockConcurrentManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+    virtual bool SupportsConcurrentInitialize() const override { return true; }
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockCycleAManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockCycleBManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual void GetDependencies(TArray<TSubclassOf<UManagerBase>>& OutDependencies) const override;
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockPrePhysicsManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PrePhysics;
+    }
+};
+
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockWorkerTickManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    virtual EManagerTickPhase GetTickPhase() const override {
+        return EManagerTickPhase::PostPhysics;
+    }
+
+    virtual bool IsTickThreadSafe() const override { return true; }
+};
+
+/**
+ * Manager that preloads an engine material, and reveals a second one from the next preload
+ * round on, as if it were referenced by the first.
+ */
+UCLASS()
+class DDKNOCKOFFTESTS_API UMockPreloadManager : public UMockOrderedManager {
+    GENERATED_BODY()
+
+public:
+    static const TCHAR* FirstAssetPath;
+    static const TCHAR* SecondAssetPath;
+
+    virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+
+private:
+    mutable int32 PreloadRequests = 0;
+};
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "TestWorldEngineSubsystem.h"
 
+class UBoxComponent;
+
 /**
  * Generic test utilities for DDKnockoff testing framework
  * Provides common functionality that can be used across all test types
@@ -20,6 +22,15 @@ public:
                                  float TimeoutSeconds = 10.0f,
                                  const FString& DescriptionForLogging = TEXT("condition"));
 
+    // Enemy class from the wave settings asset, nullptr if none is configured
+    static UClass* LoadEnemyCharacterClass();
+
+    // Attach a hurtbox to an actor so enemy target detection overlaps it, beginning any overlaps
+    // it spawned into
+    static UBoxComponent* AddHurtbox(AActor* Actor,
+                                     const FVector& RelativeLocation = FVector::ZeroVector,
+                                     const FVector& BoxExtent = FVector(100.0f));
+
     // Entity damage waiting - specialized condition waiter for damage verification
     template <typename TEntity>
     static bool WaitForEntityDamage(const FTestWorldHelper* WorldHelper,